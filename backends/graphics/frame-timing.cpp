@@ -0,0 +1,208 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "backends/graphics/frame-timing.h"
+
+#include "common/config-manager.h"
+#include "common/debug.h"
+#include "common/file.h"
+#include "common/textconsole.h"
+#include "common/util.h"
+
+/** Number of recent frames used for the summary. */
+static const uint kSummaryFrames = 120;
+
+FrameTiming::FrameTiming() : _enabled(false), _showOverlay(false) {
+	reset();
+
+	if (ConfMan.hasKey("frame_timing"))
+		setEnabled(ConfMan.getBool("frame_timing"));
+	if (ConfMan.hasKey("frame_timing_osd"))
+		_showOverlay = ConfMan.getBool("frame_timing_osd");
+	if (ConfMan.hasKey("frame_timing_csv"))
+		_csvFilename = ConfMan.get("frame_timing_csv");
+}
+
+FrameTiming::~FrameTiming() {
+	if (!_enabled || !_frameCount)
+		return;
+
+	debug(1, "Frame timing:\n%s", getSummary().c_str());
+	debug(1, "Frame interval histogram:\n%s", getHistogram().c_str());
+
+	if (!_csvFilename.empty() && !dumpCSV(_csvFilename))
+		warning("Could not write frame timing to '%s'", _csvFilename.c_str());
+}
+
+void FrameTiming::setEnabled(bool enabled) {
+	if (enabled == _enabled)
+		return;
+
+	_enabled = enabled;
+	reset();
+	if (_enabled)
+		_history.resize(kHistoryLength);
+	else
+		_history.clear();
+}
+
+void FrameTiming::reset() {
+	_frameStart = 0;
+	_lastFrameStart = 0;
+	for (int i = 0; i < kStageCount; ++i) {
+		_stageStart[i] = 0;
+		_stageTime[i] = 0;
+	}
+	_historyPos = 0;
+	_frameCount = 0;
+	for (int i = 0; i < kHistogramBuckets; ++i)
+		_histogram[i] = 0;
+	_lastOverlay = 0;
+}
+
+void FrameTiming::startFrame() {
+	_frameStart = g_system->getMicros();
+	for (int i = 0; i < kStageCount; ++i)
+		_stageTime[i] = 0;
+}
+
+void FrameTiming::finishFrame() {
+	Frame &frame = _history[_historyPos];
+	frame.total = (uint32)(g_system->getMicros() - _frameStart);
+	frame.interval = _lastFrameStart ? (uint32)(_frameStart - _lastFrameStart) : 0;
+	for (int i = 0; i < kStageCount; ++i)
+		frame.stages[i] = _stageTime[i];
+
+	// The first frame has no predecessor, so there is no interval to count
+	if (_lastFrameStart)
+		++_histogram[MIN<uint32>(frame.interval / 1000, kHistogramBuckets - 1)];
+
+	_lastFrameStart = _frameStart;
+	_historyPos = (_historyPos + 1) % kHistoryLength;
+	++_frameCount;
+}
+
+uint FrameTiming::getHistorySize() const {
+	return MIN<uint32>(_frameCount, kHistoryLength);
+}
+
+const FrameTiming::Frame &FrameTiming::getFrame(uint index) const {
+	// index 0 is the oldest frame still in the history
+	const uint size = getHistorySize();
+	return _history[(_historyPos + kHistoryLength - size + index) % kHistoryLength];
+}
+
+Common::String FrameTiming::getSummary() const {
+	const uint size = getHistorySize();
+	const uint count = MIN(size, kSummaryFrames);
+	if (!count)
+		return "No frames recorded";
+
+	uint64 intervalSum = 0, totalSum = 0;
+	uint64 stageSum[kStageCount] = { 0 };
+	uint32 minInterval = 0xFFFFFFFF, maxInterval = 0;
+	uint intervals = 0;
+	for (uint i = size - count; i < size; ++i) {
+		const Frame &frame = getFrame(i);
+		totalSum += frame.total;
+		for (int j = 0; j < kStageCount; ++j)
+			stageSum[j] += frame.stages[j];
+
+		if (!frame.interval)
+			continue;
+		intervalSum += frame.interval;
+		minInterval = MIN(minInterval, frame.interval);
+		maxInterval = MAX(maxInterval, frame.interval);
+		++intervals;
+	}
+
+	// The jitter is the standard deviation of the frame interval
+	double mean = intervals ? (double)intervalSum / intervals : 0.0;
+	double variance = 0.0;
+	for (uint i = size - count; i < size; ++i) {
+		const Frame &frame = getFrame(i);
+		if (frame.interval)
+			variance += ((double)frame.interval - mean) * ((double)frame.interval - mean);
+	}
+	if (intervals)
+		variance /= intervals;
+	else
+		minInterval = 0;
+
+	return Common::String::format(
+		"Frame: %.2f ms (%.2f-%.2f), jitter %.2f ms\n"
+		"Update: %.2f ms (scale %.2f, cursor %.2f, present %.2f)",
+		mean / 1000.0, minInterval / 1000.0, maxInterval / 1000.0, sqrt(variance) / 1000.0,
+		totalSum / 1000.0 / count, stageSum[kStageScale] / 1000.0 / count,
+		stageSum[kStageCursor] / 1000.0 / count, stageSum[kStagePresent] / 1000.0 / count);
+}
+
+Common::String FrameTiming::getHistogram() const {
+	uint32 maxCount = 0;
+	int lastBucket = -1;
+	for (int i = 0; i < kHistogramBuckets; ++i) {
+		maxCount = MAX(maxCount, _histogram[i]);
+		if (_histogram[i])
+			lastBucket = i;
+	}
+
+	Common::String result;
+	for (int i = 0; i <= lastBucket; ++i) {
+		const uint bar = (uint)((uint64)_histogram[i] * 40 / maxCount);
+		result += Common::String::format("%3d%s ms %7u ", i, i == kHistogramBuckets - 1 ? "+" : " ", _histogram[i]);
+		for (uint j = 0; j < bar; ++j)
+			result += '#';
+		result += '\n';
+	}
+	return result;
+}
+
+bool FrameTiming::dumpCSV(const Common::String &filename) const {
+	Common::DumpFile file;
+	if (!file.open(filename))
+		return false;
+
+	file.writeString("frame,interval_us,update_us,scale_us,cursor_us,present_us\n");
+
+	const uint size = getHistorySize();
+	const uint32 firstFrame = _frameCount - size;
+	for (uint i = 0; i < size; ++i) {
+		const Frame &frame = getFrame(i);
+		file.writeString(Common::String::format("%u,%u,%u,%u,%u,%u\n", firstFrame + i, frame.interval, frame.total,
+		                                        frame.stages[kStageScale], frame.stages[kStageCursor], frame.stages[kStagePresent]));
+	}
+
+	file.flush();
+	return !file.err();
+}
+
+bool FrameTiming::shouldShowOverlay() {
+	if (!_enabled || !_showOverlay)
+		return false;
+
+	const uint64 now = g_system->getMicros();
+	if (_lastOverlay && now - _lastOverlay < 1000000)
+		return false;
+
+	_lastOverlay = now;
+	return true;
+}
@@ -0,0 +1,161 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef BACKENDS_GRAPHICS_FRAME_TIMING_H
+#define BACKENDS_GRAPHICS_FRAME_TIMING_H
+
+#include "common/array.h"
+#include "common/str.h"
+#include "common/system.h"
+
+/**
+ * Collects frame pacing statistics for OSystem::updateScreen().
+ *
+ * For every frame the interval since the previous frame, the CPU time
+ * spent inside updateScreen() and the time spent in a few well known
+ * stages of it are recorded. The last kHistoryLength frames are kept so
+ * they can be written to a CSV file, and the frame intervals of all frames
+ * are accumulated into a histogram with one millisecond buckets to show
+ * the jitter.
+ *
+ * Recording is disabled by default and controlled by the "frame_timing"
+ * config key. When it is disabled all methods return immediately.
+ */
+class FrameTiming {
+public:
+	enum Stage {
+		/** Scaling and pixel format conversion of the game screen */
+		kStageScale,
+		/** Drawing and removing the mouse cursor */
+		kStageCursor,
+		/** Handing the finished frame over to the display */
+		kStagePresent,
+
+		kStageCount
+	};
+
+	enum {
+		kHistoryLength = 1024,
+		/** The last bucket holds all frames taking this long or longer */
+		kHistogramBuckets = 50
+	};
+
+	FrameTiming();
+	~FrameTiming();
+
+	bool isEnabled() const { return _enabled; }
+	void setEnabled(bool enabled);
+
+	/** Discard all collected statistics. */
+	void reset();
+
+	void beginFrame() {
+		if (_enabled)
+			startFrame();
+	}
+
+	void endFrame() {
+		if (_enabled)
+			finishFrame();
+	}
+
+	void beginStage(Stage stage) {
+		if (_enabled)
+			_stageStart[stage] = g_system->getMicros();
+	}
+
+	void endStage(Stage stage) {
+		if (_enabled)
+			_stageTime[stage] += (uint32)(g_system->getMicros() - _stageStart[stage]);
+	}
+
+	/** Number of frames recorded since the last reset. */
+	uint32 getFrameCount() const { return _frameCount; }
+
+	/**
+	 * Get a short, multi-line summary of the recent frames, suitable for
+	 * the OSD.
+	 */
+	Common::String getSummary() const;
+
+	/** Get the frame interval histogram as text. */
+	Common::String getHistogram() const;
+
+	/**
+	 * Write the recorded frames, oldest first, to a CSV file. All times
+	 * are in microseconds.
+	 */
+	bool dumpCSV(const Common::String &filename) const;
+
+	/**
+	 * Check whether the summary should be displayed on the OSD. This
+	 * returns true at most once per second.
+	 */
+	bool shouldShowOverlay();
+
+private:
+	struct Frame {
+		uint32 interval;
+		uint32 total;
+		uint32 stages[kStageCount];
+	};
+
+	void startFrame();
+	void finishFrame();
+	const Frame &getFrame(uint index) const;
+	uint getHistorySize() const;
+
+	bool _enabled;
+	bool _showOverlay;
+	Common::String _csvFilename;
+
+	uint64 _frameStart;
+	uint64 _lastFrameStart;
+	uint64 _stageStart[kStageCount];
+	uint32 _stageTime[kStageCount];
+
+	Common::Array<Frame> _history;
+	uint _historyPos;
+	uint32 _frameCount;
+	uint32 _histogram[kHistogramBuckets];
+	uint64 _lastOverlay;
+};
+
+/**
+ * Measures a frame stage for the lifetime of the object.
+ */
+class FrameTimingStage {
+public:
+	FrameTimingStage(FrameTiming &timing, FrameTiming::Stage stage) : _timing(timing), _stage(stage) {
+		_timing.beginStage(_stage);
+	}
+
+	~FrameTimingStage() {
+		_timing.endStage(_stage);
+	}
+
+private:
+	FrameTiming &_timing;
+	FrameTiming::Stage _stage;
+};
+
+#endif
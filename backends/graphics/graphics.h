@@ -27,6 +27,8 @@
 #include "common/noncopyable.h"
 #include "common/keyboard.h"
 
+#include "backends/graphics/frame-timing.h"
+
 #include "graphics/mode.h"
 #include "graphics/palette.h"
 
@@ -106,10 +108,16 @@ public:
 	virtual void displayMessageOnOSD(const char *msg) {}
 	virtual void displayActivityIconOnOSD(const Graphics::Surface *icon) {}
 
+	/** Frame pacing statistics, updated by the backend around updateScreen(). */
+	FrameTiming &getFrameTiming() { return _frameTiming; }
+
 
 	// Graphics::PaletteManager interface
 	//virtual void setPalette(const byte *colors, uint start, uint num) = 0;
 	//virtual void grabPalette(byte *colors, uint start, uint num) const = 0;
+
+protected:
+	FrameTiming _frameTiming;
 };
 
 #endif
@@ -38,6 +38,8 @@ void Context::reset() {
 	shadersSupported = false;
 	multitextureSupported = false;
 	framebufferObjectSupported = false;
+	unpackSubimageSupported = false;
+	pixelBufferObjectSupported = false;
 
 #define GL_FUNC_DEF(ret, name, param) name = nullptr;
 #include "backends/graphics/opengl/opengl-func.h"
@@ -119,6 +121,8 @@ void OpenGLGraphicsManager::initializeGLContext() {
 	bool ARBShadingLanguage100 = false;
 	bool ARBVertexShader = false;
 	bool ARBFragmentShader = false;
+	bool ARBVertexBufferObject = false;
+	bool ARBPixelBufferObject = false;
 
 	Common::StringTokenizer tokenizer(extString, " ");
 	while (!tokenizer.empty()) {
@@ -138,6 +142,12 @@ void OpenGLGraphicsManager::initializeGLContext() {
 			g_context.multitextureSupported = true;
 		} else if (token == "GL_EXT_framebuffer_object") {
 			g_context.framebufferObjectSupported = true;
+		} else if (token == "GL_EXT_unpack_subimage") {
+			g_context.unpackSubimageSupported = true;
+		} else if (token == "GL_ARB_vertex_buffer_object") {
+			ARBVertexBufferObject = true;
+		} else if (token == "GL_ARB_pixel_buffer_object") {
+			ARBPixelBufferObject = true;
 		}
 	}
 
@@ -157,6 +167,21 @@ void OpenGLGraphicsManager::initializeGLContext() {
 		g_context.shadersSupported = ARBShaderObjects & ARBShadingLanguage100 & ARBVertexShader & ARBFragmentShader;
 	}
 
+	if (g_context.type == kContextGL) {
+		// Desktop GL always supports GL_UNPACK_ROW_LENGTH.
+		g_context.unpackSubimageSupported = true;
+
+		g_context.pixelBufferObjectSupported = ARBVertexBufferObject & ARBPixelBufferObject;
+	} else if (g_context.type == kContextGLES) {
+		// GLES 1 has no GL_EXT_unpack_subimage version.
+		g_context.unpackSubimageSupported = false;
+	}
+
+#if USE_FORCED_GLES || USE_FORCED_GLES2
+	// The buffer object functions are not available in GLES builds.
+	g_context.pixelBufferObjectSupported = false;
+#endif
+
 	// Log context type.
 	switch (g_context.type) {
 	case kContextGL:
@@ -181,6 +206,8 @@ void OpenGLGraphicsManager::initializeGLContext() {
 	debug(5, "OpenGL: Shader support: %d", g_context.shadersSupported);
 	debug(5, "OpenGL: Multitexture support: %d", g_context.multitextureSupported);
 	debug(5, "OpenGL: FBO support: %d", g_context.framebufferObjectSupported);
+	debug(5, "OpenGL: Unpack subimage support: %d", g_context.unpackSubimageSupported);
+	debug(5, "OpenGL: PBO support: %d", g_context.pixelBufferObjectSupported);
 }
 
 } // End of namespace OpenGL
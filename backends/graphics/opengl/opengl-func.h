@@ -142,6 +142,15 @@ GL_FUNC_2_DEF(GLenum, glCheckFramebufferStatus, glCheckFramebufferStatusEXT, (GL
 GL_FUNC_2_DEF(void, glActiveTexture, glActiveTextureARB, (GLenum texture));
 #endif
 
+#if !USE_FORCED_GLES && !USE_FORCED_GLES2
+GL_EXT_FUNC_DEF(void, glGenBuffersARB, (GLsizei n, GLuint *buffers));
+GL_EXT_FUNC_DEF(void, glDeleteBuffersARB, (GLsizei n, const GLuint *buffers));
+GL_EXT_FUNC_DEF(void, glBindBufferARB, (GLenum target, GLuint buffer));
+GL_EXT_FUNC_DEF(void, glBufferDataARB, (GLenum target, GLsizeiptr size, const GLvoid *data, GLenum usage));
+GL_EXT_FUNC_DEF(GLvoid *, glMapBufferARB, (GLenum target, GLenum access));
+GL_EXT_FUNC_DEF(GLboolean, glUnmapBufferARB, (GLenum target));
+#endif
+
 #ifdef DEFINED_GL_EXT_FUNC_DEF
 #undef DEFINED_GL_EXT_FUNC_DEF
 #undef GL_EXT_FUNC_DEF
@@ -493,11 +493,14 @@ void OpenGLGraphicsManager::updateScreen() {
 	}
 
 	// Update changes to textures.
+	_frameTiming.beginStage(FrameTiming::kStageScale);
 	_gameScreen->updateGLTexture();
+	_overlay->updateGLTexture();
+	_frameTiming.endStage(FrameTiming::kStageScale);
 	if (_cursorVisible && _cursor) {
+		FrameTimingStage timing(_frameTiming, FrameTiming::kStageCursor);
 		_cursor->updateGLTexture();
 	}
-	_overlay->updateGLTexture();
 
 	// Clear the screen buffer.
 	GL_CALL(glClear(GL_COLOR_BUFFER_BIT));
@@ -587,6 +590,8 @@ void OpenGLGraphicsManager::updateScreen() {
 
 	_cursorNeedsRedraw = false;
 	_forceRedraw = false;
+
+	FrameTimingStage timing(_frameTiming, FrameTiming::kStagePresent);
 	refreshScreen();
 }
 
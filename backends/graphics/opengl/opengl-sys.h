@@ -129,6 +129,15 @@ struct Context {
 	/** Whether FBO support is available or not. */
 	bool framebufferObjectSupported;
 
+	/**
+	 * Whether GL_UNPACK_ROW_LENGTH is available or not. This allows
+	 * uploading a sub-rectangle of a surface without copying it first.
+	 */
+	bool unpackSubimageSupported;
+
+	/** Whether pixel buffer objects can be used for texture uploads. */
+	bool pixelBufferObjectSupported;
+
 #define GL_FUNC_DEF(ret, name, param) ret (GL_CALL_CONV *name)param
 #include "backends/graphics/opengl/opengl-func.h"
 #undef GL_FUNC_DEF
@@ -38,11 +38,20 @@ GLTexture::GLTexture(GLenum glIntFormat, GLenum glFormat, GLenum glType)
       _width(0), _height(0), _logicalWidth(0), _logicalHeight(0),
       _texCoords(), _glFilter(GL_NEAREST),
       _glTexture(0) {
+#if !USE_FORCED_GLES && !USE_FORCED_GLES2
+	_pixelBuffers[0] = _pixelBuffers[1] = 0;
+	_nextPixelBuffer = 0;
+#endif
 	create();
 }
 
 GLTexture::~GLTexture() {
 	GL_CALL_SAFE(glDeleteTextures, (1, &_glTexture));
+#if !USE_FORCED_GLES && !USE_FORCED_GLES2
+	if (_pixelBuffers[0]) {
+		GL_CALL_SAFE(glDeleteBuffersARB, (2, _pixelBuffers));
+	}
+#endif
 }
 
 void GLTexture::enableLinearFiltering(bool enable) {
@@ -61,6 +70,13 @@ void GLTexture::enableLinearFiltering(bool enable) {
 void GLTexture::destroy() {
 	GL_CALL(glDeleteTextures(1, &_glTexture));
 	_glTexture = 0;
+
+#if !USE_FORCED_GLES && !USE_FORCED_GLES2
+	if (_pixelBuffers[0]) {
+		GL_CALL(glDeleteBuffersARB(2, _pixelBuffers));
+		_pixelBuffers[0] = _pixelBuffers[1] = 0;
+	}
+#endif
 }
 
 void GLTexture::create() {
@@ -132,16 +148,38 @@ void GLTexture::setSize(uint width, uint height) {
 }
 
 void GLTexture::updateArea(const Common::Rect &area, const Graphics::Surface &src) {
+	if (area.isEmpty()) {
+		return;
+	}
+
 	// Set the texture on the active texture unit.
 	bind();
 
+#if !USE_FORCED_GLES && !USE_FORCED_GLES2
+	// Stream the data through a pixel buffer object when possible. This
+	// lets the driver transfer the data asynchronously.
+	if (g_context.pixelBufferObjectSupported && updateAreaPBO(area, src)) {
+		return;
+	}
+#endif
+
+#if !USE_FORCED_GLES
+	// With GL_UNPACK_ROW_LENGTH we can upload exactly the area which changed.
+	if (g_context.unpackSubimageSupported) {
+		GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, src.pitch / src.format.bytesPerPixel));
+		GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, area.left, area.top, area.width(), area.height(),
+		                        _glFormat, _glType, src.getBasePtr(area.left, area.top)));
+		GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+		return;
+	}
+#endif
+
 	// Update the actual texture.
 	// Although we have the area of the texture buffer we want to update we
 	// cannot take advantage of the left/right boundries here because it is
-	// not possible to specify a pitch to glTexSubImage2D. To be precise, with
-	// plain OpenGL we could set GL_UNPACK_ROW_LENGTH to achieve this. However,
-	// OpenGL ES 1.0 does not support GL_UNPACK_ROW_LENGTH. Thus, we are left
-	// with the following options:
+	// not possible to specify a pitch to glTexSubImage2D without
+	// GL_UNPACK_ROW_LENGTH, which OpenGL ES 1.0 and plain OpenGL ES 2.0 do
+	// not support. Thus, we are left with the following options:
 	//
 	// 1) (As we do right now) Simply always update the whole texture lines of
 	//    rect changed. This is simplest to implement. In case performance is
@@ -157,12 +195,57 @@ void GLTexture::updateArea(const Common::Rect &area, const Graphics::Surface &sr
 	                       _glFormat, _glType, src.getBasePtr(0, area.top)));
 }
 
+#if !USE_FORCED_GLES && !USE_FORCED_GLES2
+bool GLTexture::updateAreaPBO(const Common::Rect &area, const Graphics::Surface &src) {
+	if (!_pixelBuffers[0]) {
+		GL_CALL(glGenBuffersARB(2, _pixelBuffers));
+		_nextPixelBuffer = 0;
+	}
+
+	const uint rowSize = area.width() * src.format.bytesPerPixel;
+
+	GL_CALL(glBindBufferARB(GL_PIXEL_UNPACK_BUFFER, _pixelBuffers[_nextPixelBuffer]));
+	_nextPixelBuffer ^= 1;
+
+	// Orphan the previous storage of the buffer, so mapping it does not need
+	// to wait until the driver finished reading from it.
+	GL_CALL(glBufferDataARB(GL_PIXEL_UNPACK_BUFFER, rowSize * area.height(), nullptr, GL_STREAM_DRAW));
+
+	void *mapped;
+	GL_ASSIGN(mapped, glMapBufferARB(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY));
+
+	bool uploaded = false;
+	if (mapped) {
+		const byte *srcRow = (const byte *)src.getBasePtr(area.left, area.top);
+		byte *dstRow = (byte *)mapped;
+		for (int y = area.top; y < area.bottom; ++y) {
+			memcpy(dstRow, srcRow, rowSize);
+			srcRow += src.pitch;
+			dstRow += rowSize;
+		}
+
+		// The buffer contents can get lost while it is mapped, in which case
+		// we fall back to uploading from client memory.
+		GLboolean unmapped;
+		GL_ASSIGN(unmapped, glUnmapBufferARB(GL_PIXEL_UNPACK_BUFFER));
+		if (unmapped) {
+			GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, area.left, area.top, area.width(), area.height(),
+			                        _glFormat, _glType, nullptr));
+			uploaded = true;
+		}
+	}
+
+	GL_CALL(glBindBufferARB(GL_PIXEL_UNPACK_BUFFER, 0));
+	return uploaded;
+}
+#endif
+
 //
 // Surface
 //
 
 Surface::Surface()
-    : _allDirty(false), _dirtyArea() {
+    : _allDirty(false), _dirtyRects() {
 }
 
 void Surface::copyRectToTexture(uint x, uint y, uint w, uint h, const void *srcPtr, uint srcPitch) {
@@ -170,15 +253,7 @@ void Surface::copyRectToTexture(uint x, uint y, uint w, uint h, const void *srcP
 	assert(x + w <= dstSurf->w);
 	assert(y + h <= dstSurf->h);
 
-	// *sigh* Common::Rect::extend behaves unexpected whenever one of the two
-	// parameters is an empty rect. Thus, we check whether the current dirty
-	// area is valid. In case it is not we simply use the parameters as new
-	// dirty area. Otherwise, we simply call extend.
-	if (_dirtyArea.isEmpty()) {
-		_dirtyArea = Common::Rect(x, y, x + w, y + h);
-	} else {
-		_dirtyArea.extend(Common::Rect(x, y, x + w, y + h));
-	}
+	addDirtyArea(Common::Rect(x, y, x + w, y + h));
 
 	const byte *src = (const byte *)srcPtr;
 	byte *dst = (byte *)dstSurf->getBasePtr(x, y);
@@ -203,11 +278,55 @@ void Surface::fill(uint32 color) {
 	flagDirty();
 }
 
+void Surface::addDirtyArea(const Common::Rect &area) {
+	// *sigh* Common::Rect::extend behaves unexpected whenever one of the two
+	// parameters is an empty rect. Thus, we ignore empty areas completely.
+	if (_allDirty || area.isEmpty()) {
+		return;
+	}
+
+	// Merge the area into an existing dirty rect in case they overlap.
+	for (DirtyRectList::iterator i = _dirtyRects.begin(); i != _dirtyRects.end(); ++i) {
+		if (i->intersects(area)) {
+			i->extend(area);
+			return;
+		}
+	}
+
+	if (_dirtyRects.size() < kMaxDirtyRects) {
+		_dirtyRects.push_back(area);
+		return;
+	}
+
+	// Too many separate areas. Uploading their bounding box is cheaper than
+	// tracking even more of them.
+	const Common::Rect bounds = getDirtyArea();
+	_dirtyRects.clear();
+	_dirtyRects.push_back(bounds);
+	_dirtyRects.back().extend(area);
+}
+
 Common::Rect Surface::getDirtyArea() const {
 	if (_allDirty) {
 		return Common::Rect(getWidth(), getHeight());
+	}
+
+	Common::Rect bounds;
+	for (DirtyRectList::const_iterator i = _dirtyRects.begin(); i != _dirtyRects.end(); ++i) {
+		if (bounds.isEmpty()) {
+			bounds = *i;
+		} else {
+			bounds.extend(*i);
+		}
+	}
+	return bounds;
+}
+
+Surface::DirtyRectList Surface::getDirtyAreas() const {
+	if (_allDirty) {
+		return DirtyRectList(1, Common::Rect(getWidth(), getHeight()));
 	} else {
-		return _dirtyArea;
+		return _dirtyRects;
 	}
 }
 
@@ -268,7 +387,17 @@ void Texture::updateGLTexture() {
 		return;
 	}
 
-	Common::Rect dirtyArea = getDirtyArea();
+	const DirtyRectList dirtyAreas = getDirtyAreas();
+	for (DirtyRectList::const_iterator i = dirtyAreas.begin(); i != dirtyAreas.end(); ++i) {
+		updateGLTextureArea(*i);
+	}
+
+	// We should have handled everything, thus not dirty anymore.
+	clearDirty();
+}
+
+void Texture::updateGLTextureArea(const Common::Rect &area) {
+	Common::Rect dirtyArea = area;
 
 	// In case we use linear filtering we might need to duplicate the last
 	// pixel row/column to avoid glitches with filtering.
@@ -300,9 +429,6 @@ void Texture::updateGLTexture() {
 	}
 
 	_glTexture.updateArea(dirtyArea, _textureData);
-
-	// We should have handled everything, thus not dirty anymore.
-	clearDirty();
 }
 
 TextureCLUT8::TextureCLUT8(GLenum glIntFormat, GLenum glFormat, GLenum glType, const Graphics::PixelFormat &format)
@@ -399,20 +525,23 @@ void TextureCLUT8::updateGLTexture() {
 	// Do the palette look up
 	Graphics::Surface *outSurf = Texture::getSurface();
 
-	Common::Rect dirtyArea = getDirtyArea();
-
-	if (outSurf->format.bytesPerPixel == 2) {
-		doPaletteLookUp<uint16>((uint16 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top),
-		                        (const byte *)_clut8Data.getBasePtr(dirtyArea.left, dirtyArea.top),
-		                        dirtyArea.width(), dirtyArea.height(),
-		                        outSurf->pitch, _clut8Data.pitch, (const uint16 *)_palette);
-	} else if (outSurf->format.bytesPerPixel == 4) {
-		doPaletteLookUp<uint32>((uint32 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top),
-		                        (const byte *)_clut8Data.getBasePtr(dirtyArea.left, dirtyArea.top),
-		                        dirtyArea.width(), dirtyArea.height(),
-		                        outSurf->pitch, _clut8Data.pitch, (const uint32 *)_palette);
-	} else {
-		warning("TextureCLUT8::updateGLTexture: Unsupported pixel depth: %d", outSurf->format.bytesPerPixel);
+	const DirtyRectList dirtyAreas = getDirtyAreas();
+	for (DirtyRectList::const_iterator i = dirtyAreas.begin(); i != dirtyAreas.end(); ++i) {
+		const Common::Rect &dirtyArea = *i;
+
+		if (outSurf->format.bytesPerPixel == 2) {
+			doPaletteLookUp<uint16>((uint16 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top),
+			                        (const byte *)_clut8Data.getBasePtr(dirtyArea.left, dirtyArea.top),
+			                        dirtyArea.width(), dirtyArea.height(),
+			                        outSurf->pitch, _clut8Data.pitch, (const uint16 *)_palette);
+		} else if (outSurf->format.bytesPerPixel == 4) {
+			doPaletteLookUp<uint32>((uint32 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top),
+			                        (const byte *)_clut8Data.getBasePtr(dirtyArea.left, dirtyArea.top),
+			                        dirtyArea.width(), dirtyArea.height(),
+			                        outSurf->pitch, _clut8Data.pitch, (const uint32 *)_palette);
+		} else {
+			warning("TextureCLUT8::updateGLTexture: Unsupported pixel depth: %d", outSurf->format.bytesPerPixel);
+		}
 	}
 
 	// Do generic handling of updating the texture.
@@ -458,25 +587,28 @@ void TextureRGB555::updateGLTexture() {
 	// Convert color space.
 	Graphics::Surface *outSurf = Texture::getSurface();
 
-	const Common::Rect dirtyArea = getDirtyArea();
+	const DirtyRectList dirtyAreas = getDirtyAreas();
+	for (DirtyRectList::const_iterator i = dirtyAreas.begin(); i != dirtyAreas.end(); ++i) {
+		const Common::Rect &dirtyArea = *i;
 
-	uint16 *dst = (uint16 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top);
-	const uint dstAdd = outSurf->pitch - 2 * dirtyArea.width();
+		uint16 *dst = (uint16 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top);
+		const uint dstAdd = outSurf->pitch - 2 * dirtyArea.width();
 
-	const uint16 *src = (const uint16 *)_rgbData.getBasePtr(dirtyArea.left, dirtyArea.top);
-	const uint srcAdd = _rgbData.pitch - 2 * dirtyArea.width();
+		const uint16 *src = (const uint16 *)_rgbData.getBasePtr(dirtyArea.left, dirtyArea.top);
+		const uint srcAdd = _rgbData.pitch - 2 * dirtyArea.width();
 
-	for (int height = dirtyArea.height(); height > 0; --height) {
-		for (int width = dirtyArea.width(); width > 0; --width) {
-			const uint16 color = *src++;
+		for (int height = dirtyArea.height(); height > 0; --height) {
+			for (int width = dirtyArea.width(); width > 0; --width) {
+				const uint16 color = *src++;
 
-			*dst++ =   ((color & 0x7C00) << 1)                             // R
-			         | (((color & 0x03E0) << 1) | ((color & 0x0200) >> 4)) // G
-			         | (color & 0x001F);                                   // B
-		}
+				*dst++ =   ((color & 0x7C00) << 1)                             // R
+				         | (((color & 0x03E0) << 1) | ((color & 0x0200) >> 4)) // G
+				         | (color & 0x001F);                                   // B
+			}
 
-		src = (const uint16 *)((const byte *)src + srcAdd);
-		dst = (uint16 *)((byte *)dst + dstAdd);
+			src = (const uint16 *)((const byte *)src + srcAdd);
+			dst = (uint16 *)((byte *)dst + dstAdd);
+		}
 	}
 
 	// Do generic handling of updating the texture.
@@ -508,23 +640,26 @@ void TextureRGBA8888Swap::updateGLTexture() {
 	// Convert color space.
 	Graphics::Surface *outSurf = Texture::getSurface();
 
-	const Common::Rect dirtyArea = getDirtyArea();
+	const DirtyRectList dirtyAreas = getDirtyAreas();
+	for (DirtyRectList::const_iterator i = dirtyAreas.begin(); i != dirtyAreas.end(); ++i) {
+		const Common::Rect &dirtyArea = *i;
 
-	uint32 *dst = (uint32 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top);
-	const uint dstAdd = outSurf->pitch - 4 * dirtyArea.width();
+		uint32 *dst = (uint32 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top);
+		const uint dstAdd = outSurf->pitch - 4 * dirtyArea.width();
 
-	const uint32 *src = (const uint32 *)_rgbData.getBasePtr(dirtyArea.left, dirtyArea.top);
-	const uint srcAdd = _rgbData.pitch - 4 * dirtyArea.width();
+		const uint32 *src = (const uint32 *)_rgbData.getBasePtr(dirtyArea.left, dirtyArea.top);
+		const uint srcAdd = _rgbData.pitch - 4 * dirtyArea.width();
 
-	for (int height = dirtyArea.height(); height > 0; --height) {
-		for (int width = dirtyArea.width(); width > 0; --width) {
-			const uint32 color = *src++;
+		for (int height = dirtyArea.height(); height > 0; --height) {
+			for (int width = dirtyArea.width(); width > 0; --width) {
+				const uint32 color = *src++;
 
-			*dst++ = SWAP_BYTES_32(color);
-		}
+				*dst++ = SWAP_BYTES_32(color);
+			}
 
-		src = (const uint32 *)((const byte *)src + srcAdd);
-		dst = (uint32 *)((byte *)dst + dstAdd);
+			src = (const uint32 *)((const byte *)src + srcAdd);
+			dst = (uint32 *)((byte *)dst + dstAdd);
+		}
 	}
 
 	// Do generic handling of updating the texture.
@@ -658,7 +793,10 @@ void TextureCLUT8GPU::updateGLTexture() {
 
 	// Update CLUT8 texture if necessary.
 	if (Surface::isDirty()) {
-		_clut8Texture.updateArea(getDirtyArea(), _clut8Data);
+		const DirtyRectList dirtyAreas = getDirtyAreas();
+		for (DirtyRectList::const_iterator i = dirtyAreas.begin(); i != dirtyAreas.end(); ++i) {
+			_clut8Texture.updateArea(*i, _clut8Data);
+		}
 		clearDirty();
 	}
 
@@ -28,6 +28,7 @@
 #include "graphics/pixelformat.h"
 #include "graphics/surface.h"
 
+#include "common/array.h"
 #include "common/rect.h"
 
 namespace OpenGL {
@@ -143,6 +144,23 @@ private:
 	GLint _glFilter;
 
 	GLuint _glTexture;
+
+#if !USE_FORCED_GLES && !USE_FORCED_GLES2
+	/**
+	 * Upload the area through a pixel buffer object.
+	 *
+	 * @return Whether the upload succeeded.
+	 */
+	bool updateAreaPBO(const Common::Rect &area, const Graphics::Surface &src);
+
+	/**
+	 * Pixel buffer objects used to stream texture data. Two of them are
+	 * used alternately so that filling one never has to wait for the
+	 * transfer of the previous upload.
+	 */
+	GLuint _pixelBuffers[2];
+	uint _nextPixelBuffer;
+#endif
 };
 
 /**
@@ -201,7 +219,7 @@ public:
 	void fill(uint32 color);
 
 	void flagDirty() { _allDirty = true; }
-	virtual bool isDirty() const { return _allDirty || !_dirtyArea.isEmpty(); }
+	virtual bool isDirty() const { return _allDirty || !_dirtyRects.empty(); }
 
 	virtual uint getWidth() const = 0;
 	virtual uint getHeight() const = 0;
@@ -239,12 +257,33 @@ public:
 	 */
 	virtual const GLTexture &getGLTexture() const = 0;
 protected:
-	void clearDirty() { _allDirty = false; _dirtyArea = Common::Rect(); }
+	typedef Common::Array<Common::Rect> DirtyRectList;
 
+	void clearDirty() { _allDirty = false; _dirtyRects.clear(); }
+
+	/**
+	 * Query the bounding box of all dirty areas.
+	 */
 	Common::Rect getDirtyArea() const;
+
+	/**
+	 * Query the dirty areas. When the whole surface is dirty, this is a
+	 * single rect covering it.
+	 */
+	DirtyRectList getDirtyAreas() const;
 private:
+	enum {
+		/**
+		 * Maximum number of separately tracked dirty rects. When more areas
+		 * get dirty, all of them are merged into their bounding box.
+		 */
+		kMaxDirtyRects = 16
+	};
+
+	void addDirtyArea(const Common::Rect &area);
+
 	bool _allDirty;
-	Common::Rect _dirtyArea;
+	DirtyRectList _dirtyRects;
 };
 
 /**
@@ -288,6 +327,11 @@ public:
 protected:
 	const Graphics::PixelFormat _format;
 
+	/**
+	 * Upload an area of the texture data to the GL texture.
+	 */
+	void updateGLTextureArea(const Common::Rect &area);
+
 private:
 	GLTexture _glTexture;
 
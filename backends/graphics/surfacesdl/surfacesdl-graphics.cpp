@@ -1231,8 +1231,10 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 	// we have to redraw the mouse, or if the cursor is alpha-blended since
 	// alpha-blended cursors will happily blend into themselves if the surface
 	// under the cursor is not reset first
-	if (_cursorNeedsRedraw || _cursorFormat.bytesPerPixel == 4)
+	if (_cursorNeedsRedraw || _cursorFormat.bytesPerPixel == 4) {
+		FrameTimingStage timing(_frameTiming, FrameTiming::kStageCursor);
 		undrawMouse();
+	}
 
 #ifdef USE_OSD
 	updateOSD();
@@ -1254,6 +1256,8 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 		uint32 srcPitch, dstPitch;
 		SDL_Rect *lastRect = _dirtyRectList + _numDirtyRects;
 
+		_frameTiming.beginStage(FrameTiming::kStageScale);
+
 		for (r = _dirtyRectList; r != lastRect; ++r) {
 			dst = *r;
 			dst.x++;	// Shift rect by one since 2xSai needs to access the data around
@@ -1297,7 +1301,7 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 					dst_y = real2Aspect(dst_y);
 
 				assert(scalerProc != NULL);
-				scalerProc((byte *)srcSurf->pixels + (r->x * 2 + 2) + (r->y + 1) * srcPitch, srcPitch,
+				_scalerPool.scale(scalerProc, scale1, (byte *)srcSurf->pixels + (r->x * 2 + 2) + (r->y + 1) * srcPitch, srcPitch,
 					(byte *)_hwScreen->pixels + dst_x * 2 + dst_y * dstPitch, dstPitch, dst_w, dst_h);
 			}
 
@@ -1314,6 +1318,8 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 		SDL_UnlockSurface(srcSurf);
 		SDL_UnlockSurface(_hwScreen);
 
+		_frameTiming.endStage(FrameTiming::kStageScale);
+
 		// Readjust the dirty rect list in case we are doing a full update.
 		// This is necessary if shaking is active.
 		if (_forceRedraw) {
@@ -1323,7 +1329,9 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 			_dirtyRectList[0].h = _videoMode.hardwareHeight;
 		}
 
+		_frameTiming.beginStage(FrameTiming::kStageCursor);
 		drawMouse();
+		_frameTiming.endStage(FrameTiming::kStageCursor);
 
 #ifdef USE_OSD
 		drawOSD();
@@ -1408,6 +1416,7 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 
 		// Finally, blit all our changes to the screen
 		if (!_displayDisabled) {
+			FrameTimingStage timing(_frameTiming, FrameTiming::kStagePresent);
 			SDL_UpdateRects(_hwScreen, _numDirtyRects, _dirtyRectList);
 		}
 	}
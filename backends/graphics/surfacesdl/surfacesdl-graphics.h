@@ -25,6 +25,7 @@
 
 #include "backends/graphics/graphics.h"
 #include "backends/graphics/sdl/sdl-graphics.h"
+#include "backends/graphics/surfacesdl/surfacesdl-scalerpool.h"
 #include "graphics/pixelformat.h"
 #include "graphics/scaler.h"
 #include "common/events.h"
@@ -328,6 +329,8 @@ protected:
 
 	ScalerProc *_scalerProc;
 	int _scalerType;
+	/** Worker threads used to scale large dirty rects in bands */
+	SurfaceSdlScalerPool _scalerPool;
 	int _transactionMode;
 
 	// Indicates whether it is needed to free _hwSurface in destructor
@@ -0,0 +1,145 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#if defined(SDL_BACKEND)
+
+#include "backends/graphics/surfacesdl/surfacesdl-scalerpool.h"
+#include "common/config-manager.h"
+#include "common/textconsole.h"
+#include "common/util.h"
+
+SurfaceSdlScalerPool::SurfaceSdlScalerPool()
+	: _numThreads(0), _startSem(nullptr), _doneSem(nullptr), _bandMutex(nullptr),
+	  _quit(false), _numBands(0), _nextBand(0) {
+
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	// The calling thread processes bands too, so one less worker than
+	// there are CPUs is needed.
+	int numThreads = SDL_GetCPUCount() - 1;
+	if (ConfMan.hasKey("scaler_threads"))
+		numThreads = ConfMan.getInt("scaler_threads");
+	numThreads = CLIP<int>(numThreads, 0, kMaxThreads);
+
+	if (numThreads == 0)
+		return;
+
+	_startSem = SDL_CreateSemaphore(0);
+	_doneSem = SDL_CreateSemaphore(0);
+	_bandMutex = SDL_CreateMutex();
+	if (!_startSem || !_doneSem || !_bandMutex) {
+		warning("Could not create scaler thread synchronization primitives: %s", SDL_GetError());
+		return;
+	}
+
+	for (int i = 0; i < numThreads; ++i) {
+		_threads[_numThreads] = SDL_CreateThread(threadProc, "ScummVM scaler", this);
+		if (!_threads[_numThreads]) {
+			warning("Could not create scaler thread: %s", SDL_GetError());
+			break;
+		}
+		++_numThreads;
+	}
+#endif
+}
+
+SurfaceSdlScalerPool::~SurfaceSdlScalerPool() {
+	_quit = true;
+	for (int i = 0; i < _numThreads; ++i)
+		SDL_SemPost(_startSem);
+	for (int i = 0; i < _numThreads; ++i)
+		SDL_WaitThread(_threads[i], nullptr);
+
+	if (_bandMutex)
+		SDL_DestroyMutex(_bandMutex);
+	if (_doneSem)
+		SDL_DestroySemaphore(_doneSem);
+	if (_startSem)
+		SDL_DestroySemaphore(_startSem);
+}
+
+void SurfaceSdlScalerPool::scale(ScalerProc *scalerProc, int scaleFactor, const uint8 *srcPtr, uint32 srcPitch,
+                                 uint8 *dstPtr, uint32 dstPitch, int width, int height) {
+	int numBands = MIN<int>(_numThreads + 1, height / kMinBandHeight);
+	if (numBands < 2 || !isScalerReentrant(scalerProc)) {
+		scalerProc(srcPtr, srcPitch, dstPtr, dstPitch, width, height);
+		return;
+	}
+
+	// Round the band height up to a multiple of four, the last band gets
+	// whatever is left.
+	const int bandHeight = ((height + numBands - 1) / numBands + 3) & ~3;
+	_numBands = 0;
+	for (int y = 0; y < height; y += bandHeight) {
+		Band &band = _bands[_numBands++];
+		band.scalerProc = scalerProc;
+		band.srcPtr = srcPtr + y * srcPitch;
+		band.srcPitch = srcPitch;
+		band.dstPtr = dstPtr + y * scaleFactor * dstPitch;
+		band.dstPitch = dstPitch;
+		band.width = width;
+		band.height = MIN(bandHeight, height - y);
+	}
+	_nextBand = 0;
+
+	const int numWorkers = MIN(_numThreads, _numBands - 1);
+	for (int i = 0; i < numWorkers; ++i)
+		SDL_SemPost(_startSem);
+
+	processBands();
+
+	for (int i = 0; i < numWorkers; ++i)
+		SDL_SemWait(_doneSem);
+}
+
+int SDLCALL SurfaceSdlScalerPool::threadProc(void *data) {
+	((SurfaceSdlScalerPool *)data)->workerLoop();
+	return 0;
+}
+
+void SurfaceSdlScalerPool::workerLoop() {
+	while (true) {
+		SDL_SemWait(_startSem);
+		if (_quit)
+			break;
+
+		processBands();
+		SDL_SemPost(_doneSem);
+	}
+}
+
+void SurfaceSdlScalerPool::processBands() {
+	while (true) {
+		SDL_LockMutex(_bandMutex);
+		const int index = _nextBand < _numBands ? _nextBand++ : -1;
+		SDL_UnlockMutex(_bandMutex);
+
+		if (index < 0)
+			break;
+
+		const Band &band = _bands[index];
+		band.scalerProc(band.srcPtr, band.srcPitch, band.dstPtr, band.dstPitch, band.width, band.height);
+	}
+}
+
+#endif
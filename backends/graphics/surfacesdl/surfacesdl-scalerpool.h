@@ -0,0 +1,100 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef BACKENDS_GRAPHICS_SURFACESDL_SCALERPOOL_H
+#define BACKENDS_GRAPHICS_SURFACESDL_SCALERPOOL_H
+
+#include "graphics/scaler.h"
+
+#include "backends/platform/sdl/sdl-sys.h"
+
+/**
+ * Small pool of worker threads used to run a scaler over a rectangle in
+ * parallel.
+ *
+ * The rectangle is cut into horizontal bands which are scaled
+ * independently. Since the scalers only read from the source surface
+ * (including the one pixel border around each band) and every band writes
+ * to its own rows of the destination, the output is identical to a single
+ * scaler call over the whole rectangle.
+ *
+ * When only one CPU is available, threads are not supported by the SDL
+ * version in use or the scaler is not reentrant (see isScalerReentrant()),
+ * scale() simply calls the scaler directly.
+ */
+class SurfaceSdlScalerPool {
+public:
+	SurfaceSdlScalerPool();
+	~SurfaceSdlScalerPool();
+
+	/**
+	 * Run a scaler over a rectangle, using the worker threads if the
+	 * rectangle is large enough. Returns once the whole rectangle has
+	 * been scaled.
+	 *
+	 * @param scalerProc  The scaler to run
+	 * @param scaleFactor The vertical scale factor of the scaler
+	 * The remaining parameters are the same as for ScalerProc.
+	 */
+	void scale(ScalerProc *scalerProc, int scaleFactor, const uint8 *srcPtr, uint32 srcPitch,
+	           uint8 *dstPtr, uint32 dstPitch, int width, int height);
+
+private:
+	enum {
+		kMaxThreads = 7,
+		kMaxBands = kMaxThreads + 1,
+		/**
+		 * Minimal height of a band. Band heights are always a multiple of
+		 * four so that scalers with a per-line pattern (TV2x, DotMatrix)
+		 * keep the same phase as with a single call.
+		 */
+		kMinBandHeight = 16
+	};
+
+	struct Band {
+		ScalerProc *scalerProc;
+		const uint8 *srcPtr;
+		uint32 srcPitch;
+		uint8 *dstPtr;
+		uint32 dstPitch;
+		int width;
+		int height;
+	};
+
+	static int SDLCALL threadProc(void *data);
+	void workerLoop();
+	/** Process bands from the queue until it is empty. */
+	void processBands();
+
+	int _numThreads;
+	SDL_Thread *_threads[kMaxThreads];
+	SDL_sem *_startSem;
+	SDL_sem *_doneSem;
+	SDL_mutex *_bandMutex;
+	bool _quit;
+
+	Band _bands[kMaxBands];
+	int _numBands;
+	int _nextBand;
+};
+
+#endif
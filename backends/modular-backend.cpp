@@ -180,7 +180,13 @@ void ModularBackend::updateScreen() {
 	g_eventRec.preDrawOverlayGui();
 #endif
 
+	FrameTiming &frameTiming = _graphicsManager->getFrameTiming();
+	frameTiming.beginFrame();
 	_graphicsManager->updateScreen();
+	frameTiming.endFrame();
+
+	if (frameTiming.shouldShowOverlay())
+		_graphicsManager->displayMessageOnOSD(frameTiming.getSummary().c_str());
 
 #ifdef ENABLE_EVENTRECORDER
 	g_eventRec.postDrawOverlayGui();
@@ -81,6 +81,9 @@ public:
 	virtual void setWindowCaption(const char *caption) override;
 	virtual void addSysArchivesToSearchSet(Common::SearchSet &s, int priority = 0) override;
 	virtual uint32 getMillis(bool skipRecord = false) override;
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	virtual uint64 getMicros() override;
+#endif
 	virtual void delayMillis(uint msecs) override;
 	virtual void getTimeAndDate(TimeDate &td) const override;
 	virtual Audio::Mixer *getMixer() override;
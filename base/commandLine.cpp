@@ -156,6 +156,9 @@ static const char HELP_STRING[] =
 	"  --record-file-name=FILE  Specify record file name\n"
 	"  --disable-display        Disable any gfx output. Used for headless events\n"
 	"                           playback by Event Recorder\n"
+	"  --benchmark=FILE         Play back recording FILE headless and as fast as\n"
+	"                           possible, then print the time spent per frame\n"
+	"  --benchmark-csv=FILE     Also write the per-frame times of --benchmark to FILE\n"
 #endif
 	"\n"
 #if defined(ENABLE_SKY) || defined(ENABLE_QUEEN)
@@ -276,6 +279,10 @@ void registerDefaults() {
 	ConfMan.registerDefault("tempo", 0);
 #ifdef ENABLE_SCUMM_7_8
 	ConfMan.registerDefault("dimuse_tempo", 10);
+	ConfMan.registerDefault("dimuse_cache", 16);
+#endif
+#ifdef ENABLE_HE
+	ConfMan.registerDefault("he_wiz_cache", 4096);
 #endif
 #endif
 
@@ -291,6 +298,8 @@ void registerDefaults() {
 	ConfMan.registerDefault("disable_display", false);
 	ConfMan.registerDefault("record_mode", "none");
 	ConfMan.registerDefault("record_file_name", "record.bin");
+	ConfMan.registerDefault("benchmark", "");
+	ConfMan.registerDefault("benchmark_csv", "");
 
 	ConfMan.registerDefault("gui_saveload_chooser", "grid");
 	ConfMan.registerDefault("gui_saveload_last_pos", "0");
@@ -588,6 +597,12 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 
 			DO_LONG_OPTION("record-file-name")
 			END_OPTION
+
+			DO_LONG_OPTION("benchmark")
+			END_OPTION
+
+			DO_LONG_OPTION("benchmark-csv")
+			END_OPTION
 #endif
 
 			DO_LONG_OPTION("opl-driver")
@@ -539,8 +539,14 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 #ifdef ENABLE_EVENTRECORDER
 			Common::String recordMode = ConfMan.get("record_mode");
 			Common::String recordFileName = ConfMan.get("record_file_name");
-
-			if (recordMode == "record") {
+			Common::String benchmarkFileName = ConfMan.get("benchmark");
+
+			if (!benchmarkFileName.empty()) {
+				// Run headless and let nothing throttle the playback
+				ConfMan.setBool("disable_display", true, Common::ConfigManager::kTransientDomain);
+				ConfMan.setInt("frame_limit", 0, Common::ConfigManager::kTransientDomain);
+				g_eventRec.initBenchmark(benchmarkFileName);
+			} else if (recordMode == "record") {
 				g_eventRec.init(g_eventRec.generateRecordFileName(ConfMan.getActiveDomainName()), GUI::EventRecorder::kRecorderRecord);
 			} else if (recordMode == "playback") {
 				g_eventRec.init(recordFileName, GUI::EventRecorder::kRecorderPlayback);
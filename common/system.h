@@ -1119,6 +1119,19 @@ public:
 	*/
 	virtual uint32 getMillis(bool skipRecord = false) = 0;
 
+	/**
+	 * Get a high resolution timestamp in microseconds, measured from an
+	 * arbitrary but fixed point in time.
+	 *
+	 * This is meant for profiling and frame pacing only: unlike getMillis()
+	 * the value is never recorded or played back by the event recorder, so
+	 * it must not influence the game state.
+	 *
+	 * The default implementation only has millisecond precision; backends
+	 * should override it if they have access to a more precise clock.
+	 */
+	virtual uint64 getMicros() { return (uint64)getMillis(true) * 1000; }
+
 	/** Delay/sleep for the specified amount of milliseconds. */
 	virtual void delayMillis(uint msecs) = 0;
 
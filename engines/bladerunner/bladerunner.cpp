@@ -34,7 +34,6 @@
 #include "bladerunner/crimes_database.h"
 #include "bladerunner/debugger.h"
 #include "bladerunner/dialogue_menu.h"
-#include "bladerunner/framelimiter.h"
 #include "bladerunner/font.h"
 #include "bladerunner/game_flags.h"
 #include "bladerunner/game_info.h"
@@ -88,6 +87,7 @@
 #include "common/translation.h"
 #include "gui/message.h"
 
+#include "engines/framelimiter.h"
 #include "engines/util.h"
 #include "engines/advancedDetector.h"
 
@@ -521,7 +521,8 @@ bool BladeRunnerEngine::startup(bool hasSavegames) {
 	_time = new Time(this);
 
 //	debug("_framesPerSecondMax:: %s", _framesPerSecondMax? "true" : "false");
-	_framelimiter = new Framelimiter(this, _framesPerSecondMax? 120 : 60);
+	_framelimiter = new FrameLimiter(_system, _framesPerSecondMax? 120 : 60);
+	_framelimiter->setBusyWait(_noDelayMillisFramelimiter);
 
 	// Try to load the SUBTITLES.MIX first, before Startup.MIX
 	// allows overriding any identically named resources (such as the original font files and as a bonus also the TRE files for the UI and dialogue menu)
@@ -49,6 +49,7 @@ class Debugger;
 }
 
 struct ADGameDescription;
+class FrameLimiter;
 
 namespace BladeRunner {
 
@@ -73,7 +74,6 @@ class DialogueMenu;
 class Elevator;
 class EndCredits;
 class ESPER;
-class Framelimiter;
 class Font;
 class GameFlags;
 class GameInfo;
@@ -166,7 +166,7 @@ public:
 	SuspectsDatabase   *_suspectsDatabase;
 	Time               *_time;
 	View               *_view;
-	Framelimiter       *_framelimiter;
+	FrameLimiter       *_framelimiter;
 	VK                 *_vk;
 	Waypoints          *_waypoints;
 	int                *_gameVars;
@@ -0,0 +1,102 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/framelimiter.h"
+
+#include "common/config-manager.h"
+#include "common/system.h"
+
+FrameLimiter::FrameLimiter(OSystem *system, uint fps, CatchUpPolicy policy)
+	: _system(system), _catchUpPolicy(policy), _busyWait(false),
+	  _frameRate(0), _frameDuration(0), _nextFrame(0), _lastFrame(0), _lastFrameDuration(0) {
+
+	if (ConfMan.hasKey("frame_limit"))
+		fps = ConfMan.getInt("frame_limit");
+
+	setFrameRate(fps);
+}
+
+void FrameLimiter::setFrameRate(uint fps) {
+	_frameRate = fps;
+	_frameDuration = fps ? 1000000 / fps : 0;
+	reset();
+}
+
+void FrameLimiter::reset() {
+	_nextFrame = 0;
+	_lastFrame = 0;
+	_lastFrameDuration = 0;
+}
+
+void FrameLimiter::wait() {
+	if (!_frameDuration)
+		return;
+
+	uint64 now = _system->getMicros();
+	if (!_nextFrame) {
+		// First frame of a new schedule
+		_nextFrame = now + _frameDuration;
+		_lastFrame = now;
+		return;
+	}
+
+	if (now < _nextFrame) {
+		sleepUntil(_nextFrame);
+		_nextFrame += _frameDuration;
+	} else if (_catchUpPolicy == kCatchUpFull && now - _nextFrame < (uint64)_frameDuration * kMaxCatchUpFrames) {
+		_nextFrame += _frameDuration;
+	} else {
+		_nextFrame = now + _frameDuration;
+	}
+
+	now = _system->getMicros();
+	_lastFrameDuration = (uint32)(now - _lastFrame);
+	_lastFrame = now;
+}
+
+void FrameLimiter::sleepUntil(uint64 deadline) {
+	uint64 now = _system->getMicros();
+	uint stalledPolls = 0;
+	while (now < deadline) {
+		const uint64 remaining = deadline - now;
+		if (!_busyWait && remaining >= kSpinMicros + 1000) {
+			_system->delayMillis((uint)((remaining - kSpinMicros) / 1000));
+
+			// A clock which does not advance while sleeping, like the one of
+			// the null backend, would make us wait forever
+			const uint64 before = now;
+			now = _system->getMicros();
+			if (now == before)
+				break;
+		} else {
+			// A coarse clock may return the same time for a while, but one
+			// which does not advance at all, like the fake timer of the event
+			// recorder, must not keep us spinning
+			const uint64 before = now;
+			now = _system->getMicros();
+			if (now != before)
+				stalledPolls = 0;
+			else if (++stalledPolls >= kMaxStalledPolls)
+				break;
+		}
+	}
+}
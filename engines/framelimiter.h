@@ -0,0 +1,119 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef ENGINES_FRAMELIMITER_H
+#define ENGINES_FRAMELIMITER_H
+
+#include "common/scummsys.h"
+
+class OSystem;
+
+/**
+ * Paces an engine main loop to a fixed frame rate.
+ *
+ * Engines call wait() once per frame, usually right before updating the
+ * screen. The frames are scheduled on the high resolution clock returned by
+ * OSystem::getMicros(): the limiter sleeps with OSystem::delayMillis() for
+ * most of the remaining time and only polls the clock for the last
+ * fraction of a millisecond, so it neither oversleeps by a whole
+ * millisecond nor burns the CPU for the whole frame.
+ *
+ * The target rate can be overridden by the user with the "frame_limit"
+ * config key; a value of 0 disables the limiter.
+ */
+class FrameLimiter {
+public:
+	enum CatchUpPolicy {
+		/**
+		 * A late frame moves the schedule: the next frame is due one
+		 * frame duration after the late one. This keeps frame times
+		 * consistent.
+		 */
+		kCatchUpNone,
+		/**
+		 * Keep the original schedule: after a late frame the following
+		 * frames are not delayed until the limiter has caught up again.
+		 * This keeps the average frame rate, which suits engines which
+		 * advance the game state by a fixed step every frame.
+		 */
+		kCatchUpFull
+	};
+
+	/**
+	 * @param system The OSystem used for timing
+	 * @param fps    The default target frame rate, 0 disables the limiter
+	 * @param policy How to deal with frames which took too long
+	 */
+	FrameLimiter(OSystem *system, uint fps, CatchUpPolicy policy = kCatchUpNone);
+
+	/** Change the target frame rate, 0 disables the limiter. */
+	void setFrameRate(uint fps);
+	uint getFrameRate() const { return _frameRate; }
+
+	void setCatchUpPolicy(CatchUpPolicy policy) { _catchUpPolicy = policy; }
+
+	/**
+	 * Poll the clock for the whole wait instead of sleeping. This is only
+	 * useful on systems where delayMillis() is very imprecise.
+	 */
+	void setBusyWait(bool busyWait) { _busyWait = busyWait; }
+
+	/**
+	 * Start a new schedule with the next call to wait(), e.g. after
+	 * loading or when the engine was paused.
+	 */
+	void reset();
+
+	/** Wait until the next frame is due. */
+	void wait();
+
+	/**
+	 * Get the time in microseconds between the last two calls to wait(),
+	 * including the time spent waiting.
+	 */
+	uint32 getLastFrameDuration() const { return _lastFrameDuration; }
+
+private:
+	enum {
+		/** Time before the deadline from which on the clock is polled */
+		kSpinMicros = 1500,
+		/** With kCatchUpFull, fall back to a new schedule when this many frames behind */
+		kMaxCatchUpFrames = 4,
+		/** Give up polling when the clock has not advanced for this many polls */
+		kMaxStalledPolls = 100000
+	};
+
+	void sleepUntil(uint64 deadline);
+
+	OSystem *_system;
+	CatchUpPolicy _catchUpPolicy;
+	bool _busyWait;
+
+	uint _frameRate;
+	uint32 _frameDuration;
+
+	uint64 _nextFrame;
+	uint64 _lastFrame;
+	uint32 _lastFrameDuration;
+};
+
+#endif
@@ -163,6 +163,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("gc_reachable",		WRAP_METHOD(Console, cmdGCShowReachable));
 	registerCmd("gc_freeable",		WRAP_METHOD(Console, cmdGCShowFreeable));
 	registerCmd("gc_normalize",		WRAP_METHOD(Console, cmdGCNormalize));
+	registerCmd("gc_stats",			WRAP_METHOD(Console, cmdGCStats));
 	// Music/SFX
 	registerCmd("songlib",			WRAP_METHOD(Console, cmdSongLib));
 	registerCmd("songinfo",			WRAP_METHOD(Console, cmdSongInfo));
@@ -225,6 +226,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("bpe",				WRAP_METHOD(Console, cmdBreakpointFunction));		// alias
 	// VM
 	registerCmd("script_steps",		WRAP_METHOD(Console, cmdScriptSteps));
+	registerCmd("vm_stats",			WRAP_METHOD(Console, cmdVMStats));
 	registerCmd("script_objects",   WRAP_METHOD(Console, cmdScriptObjects));
 	registerCmd("scro",             WRAP_METHOD(Console, cmdScriptObjects));
 	registerCmd("script_strings",   WRAP_METHOD(Console, cmdScriptStrings));
@@ -388,6 +390,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" gc_reachable - Lists all addresses directly reachable from a given memory object\n");
 	debugPrintf(" gc_freeable - Lists all addresses freeable in a given segment\n");
 	debugPrintf(" gc_normalize - Prints the \"normal\" address of a given address\n");
+	debugPrintf(" gc_stats - Shows garbage collector pause times\n");
 	debugPrintf("\n");
 	debugPrintf("Music/SFX:\n");
 	debugPrintf(" songlib - Shows the song library\n");
@@ -433,6 +436,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf("\n");
 	debugPrintf("VM:\n");
 	debugPrintf(" script_steps - Shows the number of executed SCI operations\n");
+	debugPrintf(" vm_stats - Shows message send and selector cache statistics\n");
 	debugPrintf(" vm_varlist / vmvarlist / vl - Shows the addresses of variables in the VM\n");
 	debugPrintf(" vm_vars / vmvars / vv - Displays or changes variables in the VM\n");
 	debugPrintf(" stack - Lists the specified number of stack elements\n");
@@ -2730,6 +2734,30 @@ bool Console::cmdGCInvoke(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdGCStats(int argc, const char **argv) {
+	GCStatistics &stats = _engine->_gamestate->_gcStats;
+
+	if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+		stats.reset();
+		debugPrintf("Garbage collector statistics reset\n");
+		return true;
+	} else if (argc != 1) {
+		debugPrintf("Shows garbage collector pause times since the last reset.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	debugPrintf("Collections: %d, skipped: %d\n", stats.runs, stats.skipped);
+	debugPrintf("Allocations since the last collection: %d\n", _engine->_gamestate->_segMan->getAllocationsSinceGC());
+	if (!stats.runs)
+		return true;
+
+	debugPrintf("Pause: last %d us, max %d us, average %d us\n", stats.lastPause, stats.maxPause,
+	            (uint32)(stats.totalPause / stats.runs));
+	debugPrintf("Objects freed: last %d, total %d\n", stats.lastFreed, stats.totalFreed);
+	return true;
+}
+
 bool Console::cmdGCObjects(int argc, const char **argv) {
 	AddrSet *use_map = findAllActiveReferences(_engine->_gamestate);
 
@@ -3265,6 +3293,30 @@ bool Console::cmdScriptSteps(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdVMStats(int argc, const char **argv) {
+	SelectorLookupCache &cache = _engine->_gamestate->_segMan->getSelectorLookupCache();
+
+	if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+		cache.resetStatistics();
+		debugPrintf("VM statistics reset\n");
+		return true;
+	} else if (argc != 1) {
+		debugPrintf("Shows message send and selector cache statistics since the last reset.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	const SelectorLookupCache::Statistics &stats = cache._stats;
+	const uint32 elapsed = g_system->getMillis(true) - stats.startTime;
+
+	debugPrintf("Statistics for the last %d.%03d seconds:\n", elapsed / 1000, elapsed % 1000);
+	debugPrintf("Sends: %d (%d per second)\n", stats.sends, elapsed ? (uint32)((uint64)stats.sends * 1000 / elapsed) : 0);
+	debugPrintf("Selector lookups: %d, cache hits: %d (%d%%)\n", stats.lookups, stats.hits,
+	            stats.lookups ? (uint32)((uint64)stats.hits * 100 / stats.lookups) : 0);
+	debugPrintf("Selector cache clears: %d\n", stats.clears);
+	return true;
+}
+
 bool Console::cmdScriptObjects(int argc, const char **argv) {
 	int curScriptNr = -1;
 
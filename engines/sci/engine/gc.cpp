@@ -22,6 +22,7 @@
 
 #include "sci/engine/gc.h"
 #include "common/array.h"
+#include "common/system.h"
 #include "sci/graphics/ports.h"
 
 #ifdef ENABLE_SCI32
@@ -181,6 +182,8 @@ AddrSet *findAllActiveReferences(EngineState *s) {
 
 void run_gc(EngineState *s) {
 	SegManager *segMan = s->_segMan;
+	const uint64 startTime = g_system->getMicros();
+	uint32 freed = 0;
 
 	// Some debug stuff
 	debugC(kDebugLevelGC, "[GC] Running...");
@@ -214,6 +217,7 @@ void run_gc(EngineState *s) {
 				if (!activeRefs->contains(addr)) {
 					// Not found -> we can free it
 					mobj->freeAtAddress(segMan, addr);
+					freed++;
 					debugC(kDebugLevelGC, "[GC] Deallocating %04x:%04x", PRINT_REG(addr));
 #ifdef GC_DEBUG_CODE
 					segcount[type]++;
@@ -226,6 +230,17 @@ void run_gc(EngineState *s) {
 
 	delete activeRefs;
 
+	segMan->resetAllocationsSinceGC();
+
+	GCStatistics &stats = s->_gcStats;
+	stats.lastPause = (uint32)(g_system->getMicros() - startTime);
+	stats.maxPause = MAX(stats.maxPause, stats.lastPause);
+	stats.totalPause += stats.lastPause;
+	stats.lastFreed = freed;
+	stats.totalFreed += freed;
+	stats.runs++;
+	debugC(kDebugLevelGC, "[GC] Freed %d objects in %d us", freed, stats.lastPause);
+
 #ifdef GC_DEBUG_CODE
 	// Output debug summary of garbage collection
 	debugC(kDebugLevelGC, "[GC] Summary:");
@@ -235,4 +250,18 @@ void run_gc(EngineState *s) {
 #endif
 }
 
+bool run_gc_if_needed(EngineState *s) {
+	// Objects which became unreachable since the last collection stay
+	// around until something new is allocated. This costs no memory beyond
+	// what the game already used, and spares the full mark phase while the
+	// scripts only shuffle existing objects around.
+	if (!s->_segMan->getAllocationsSinceGC()) {
+		s->_gcStats.skipped++;
+		return false;
+	}
+
+	run_gc(s);
+	return true;
+}
+
 } // End of namespace Sci
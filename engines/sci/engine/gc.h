@@ -55,6 +55,15 @@ AddrSet *findAllActiveReferences(EngineState *s);
  */
 void run_gc(EngineState *s);
 
+/**
+ * Runs garbage collection, unless nothing was allocated and no script was
+ * unloaded since the last collection. Used for the periodic collections of
+ * the VM.
+ * @param s The state in which we should gc
+ * @return true if the garbage collection was run
+ */
+bool run_gc_if_needed(EngineState *s);
+
 struct WorklistManager {
 	Common::Array<reg_t> _worklist;
 	AddrSet _map;	// used for 2 contains() calls, inside push() and run_gc()
@@ -199,6 +199,10 @@ reg_t kMemorySegment(EngineState *s, int argc, reg_t *argv) {
 reg_t kFlushResources(EngineState *s, int argc, reg_t *argv) {
 	run_gc(s);
 	debugC(kDebugLevelRoom, "Entering room number %d", argv[0].toUint16());
+
+	// Rooms usually draw the picture with their own number. Queue it, so it
+	// gets loaded if the game waits before drawing it.
+	g_sci->getResMan()->queuePrefetch(ResourceId(kResourceTypePic, argv[0].toUint16()));
 	return s->r_acc;
 }
 
@@ -117,10 +117,14 @@ struct Vertex {
 	// Previous vertex in shortest path
 	Vertex *path_prev;
 
+	// Index in PathfindingState::vertex_index
+	int idx;
+
 public:
 	Vertex(const Common::Point &p) : v(p) {
 		costG = HUGE_DISTANCE;
 		path_prev = NULL;
+		idx = -1;
 	}
 };
 
@@ -263,6 +267,11 @@ struct PathfindingState {
 	// Screen size
 	int _width, _height;
 
+	// Cached visibility between the polygon vertices, if it can be used
+	AvoidPathCache *_visibilityCache;
+	// Index of the first polygon vertex in vertex_index
+	int _cacheOffset;
+
 	PathfindingState(int width, int height) : _width(width), _height(height) {
 		vertex_start = NULL;
 		vertex_end = NULL;
@@ -270,6 +279,8 @@ struct PathfindingState {
 		_prependPoint = NULL;
 		_appendPoint = NULL;
 		vertices = 0;
+		_visibilityCache = NULL;
+		_cacheOffset = 0;
 	}
 
 	~PathfindingState() {
@@ -699,6 +710,39 @@ static int inside(const Common::Point &p, Vertex *vertex) {
 	return 0;
 }
 
+/**
+ * Determines whether a vertex is visible from another vertex.
+ * @param s				the pathfinding state
+ * @param vertex_cur	the vertex to look from
+ * @param vertex		the vertex to look at
+ * @return true if vertex is visible from vertex_cur
+ */
+static bool is_visible(PathfindingState *s, Vertex *vertex_cur, Vertex *vertex) {
+	// Make sure we don't intersect a polygon locally at the vertices
+	if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
+		return false;
+
+	// Check for intersecting edges
+	for (int j = 0; j < s->vertices; j++) {
+		Vertex *edge = s->vertex_index[j];
+		if (VERTEX_HAS_EDGES(edge)) {
+			if (between(vertex_cur->v, vertex->v, edge->v)) {
+				// If we hit a vertex, make sure we can pass through it without intersecting its polygon
+				if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
+					return false;
+
+				// This edge won't properly intersect, so we continue
+				continue;
+			}
+
+			if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
+				return false;
+		}
+	}
+
+	return true;
+}
+
 /**
  * Returns a list of all vertices that are visible from a particular vertex.
  * @param s				the pathfinding state
@@ -707,37 +751,42 @@ static int inside(const Common::Point &p, Vertex *vertex) {
  */
 static VertexList *visible_vertices(PathfindingState *s, Vertex *vertex_cur) {
 	VertexList *visVerts = new VertexList();
+	AvoidPathCache *cache = s->_visibilityCache;
 
-	for (int i = 0; i < s->vertices; i++) {
-		Vertex *vertex = s->vertex_index[i];
+	if (!cache || vertex_cur->idx < s->_cacheOffset) {
+		for (int i = 0; i < s->vertices; i++) {
+			Vertex *vertex = s->vertex_index[i];
 
-		// Make sure we don't intersect a polygon locally at the vertices
-		if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
-			continue;
+			if (is_visible(s, vertex_cur, vertex))
+				visVerts->push_front(vertex);
+		}
 
-		// Check for intersecting edges
-		int j;
-		for (j = 0; j < s->vertices; j++) {
-			Vertex *edge = s->vertex_index[j];
-			if (VERTEX_HAS_EDGES(edge)) {
-				if (between(vertex_cur->v, vertex->v, edge->v)) {
-					// If we hit a vertex, make sure we can pass through it without intersecting its polygon
-					if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
-						break;
-
-					// This edge won't properly intersect, so we continue
-					continue;
-				}
+		return visVerts;
+	}
 
-				if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
-					break;
-			}
-		}
+	// The start and end points come first in vertex_index. They don't have
+	// edges, so they have no influence on the visibility between the polygon
+	// vertices, which is taken from the cache.
+	for (int i = 0; i < s->_cacheOffset; i++) {
+		Vertex *vertex = s->vertex_index[i];
 
-		if (j == s->vertices)
+		if (is_visible(s, vertex_cur, vertex))
 			visVerts->push_front(vertex);
 	}
 
+	const uint row = vertex_cur->idx - s->_cacheOffset;
+	if (!cache->rowComputed[row]) {
+		for (int i = s->_cacheOffset; i < s->vertices; i++) {
+			if (is_visible(s, vertex_cur, s->vertex_index[i]))
+				cache->visibility[row].push_back(i - s->_cacheOffset);
+		}
+		cache->rowComputed[row] = true;
+	}
+
+	const Common::Array<uint16> &visible = cache->visibility[row];
+	for (uint i = 0; i < visible.size(); i++)
+		visVerts->push_front(s->vertex_index[s->_cacheOffset + visible[i]]);
+
 	return visVerts;
 }
 
@@ -1339,15 +1388,123 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 		Vertex *vertex;
 
 		CLIST_FOREACH(vertex, &polygon->vertices) {
+			vertex->idx = count;
 			pf_s->vertex_index[count++] = vertex;
 		}
 	}
 
 	pf_s->vertices = count;
 
+	// The cached visibility graph can only be used if the start and end points
+	// did not change the polygons, i.e. when merge_point() added them as new
+	// single-vertex polygons in front of the polygon list.
+	if (count >= 2 && pf_s->vertex_index[0] == pf_s->vertex_end && pf_s->vertex_index[1] == pf_s->vertex_start &&
+	    !VERTEX_HAS_EDGES(pf_s->vertex_end) && !VERTEX_HAS_EDGES(pf_s->vertex_start)) {
+		AvoidPathCache &cache = s->_avoidPathCache;
+
+		// Describe the final polygon set for the visibility cache. The fixups
+		// above may have removed polygons, so this can only be done now. The
+		// two polygons in front are the start and end points.
+		Common::Array<int16> polygonKey;
+		PolygonList::iterator it = pf_s->polygons.begin();
+		++it;
+		++it;
+		for (; it != pf_s->polygons.end(); ++it) {
+			Vertex *vertex;
+
+			polygonKey.push_back((*it)->type);
+			polygonKey.push_back((*it)->vertices.size());
+			CLIST_FOREACH(vertex, &(*it)->vertices) {
+				polygonKey.push_back(vertex->v.x);
+				polygonKey.push_back(vertex->v.y);
+			}
+		}
+
+		if (cache.polygons != polygonKey || cache.visibility.size() != (uint)(count - 2)) {
+			cache.polygons = polygonKey;
+			cache.visibility.clear();
+			cache.visibility.resize(count - 2);
+			cache.rowComputed.clear();
+			cache.rowComputed.resize(count - 2);
+			for (int i = 0; i < count - 2; i++)
+				cache.rowComputed[i] = false;
+		}
+
+		pf_s->_visibilityCache = &cache;
+		pf_s->_cacheOffset = 2;
+	}
+
 	return pf_s;
 }
 
+/**
+ * Priority queue of the vertices in the A* open set, implemented as a binary
+ * heap. A vertex is pushed again whenever its F cost is lowered, AStar() skips
+ * the outdated entries.
+ */
+class OpenSet {
+public:
+	bool empty() const {
+		return _heap.empty();
+	}
+
+	void push(Vertex *vertex, uint32 order) {
+		Entry entry;
+		entry.costF = vertex->costF;
+		entry.order = order;
+		entry.vertex = vertex;
+
+		uint i = _heap.size();
+		_heap.push_back(entry);
+		while (i > 0 && before(entry, _heap[(i - 1) / 2])) {
+			_heap[i] = _heap[(i - 1) / 2];
+			i = (i - 1) / 2;
+		}
+		_heap[i] = entry;
+	}
+
+	Vertex *pop() {
+		Vertex *vertex = _heap[0].vertex;
+		const Entry last = _heap.back();
+		_heap.pop_back();
+
+		const uint size = _heap.size();
+		if (size) {
+			uint i = 0;
+			while (2 * i + 1 < size) {
+				uint child = 2 * i + 1;
+				if (child + 1 < size && before(_heap[child + 1], _heap[child]))
+					++child;
+				if (!before(_heap[child], last))
+					break;
+				_heap[i] = _heap[child];
+				i = child;
+			}
+			_heap[i] = last;
+		}
+
+		return vertex;
+	}
+
+private:
+	struct Entry {
+		uint32 costF;
+		uint32 order;
+		Vertex *vertex;
+	};
+
+	/**
+	 * Returns whether a has to be popped before b. Of the vertices with the
+	 * lowest F cost, the one which entered the open set last is picked, which
+	 * is the order the original list based open set was searched in.
+	 */
+	static bool before(const Entry &a, const Entry &b) {
+		return a.costF < b.costF || (a.costF == b.costF && a.order > b.order);
+	}
+
+	Common::Array<Entry> _heap;
+};
+
 /**
  * Computes a shortest path from vertex_start to vertex_end. The caller can
  * construct the resulting path by following the path_prev links from
@@ -1357,39 +1514,36 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
  */
 static void AStar(PathfindingState *s) {
 	// Vertices of which the shortest path is known
-	VertexList closedSet;
+	Common::Array<bool> closedSet(s->vertices, false);
 
-	// The remaining vertices
-	VertexList openSet;
+	// The remaining vertices, and the order in which they entered the open
+	// set, 0 if they didn't
+	OpenSet openSet;
+	Common::Array<uint32> openSetOrder(s->vertices, 0);
+	uint32 nextOrder = 1;
+	bool reachedEnd = false;
 
-	openSet.push_front(s->vertex_start);
 	s->vertex_start->costG = 0;
 	s->vertex_start->costF = (uint32)sqrt((float)s->vertex_start->v.sqrDist(s->vertex_end->v));
+	openSetOrder[s->vertex_start->idx] = nextOrder++;
+	openSet.push(s->vertex_start, openSetOrder[s->vertex_start->idx]);
 
 	while (!openSet.empty()) {
 		// Find vertex in open set with lowest F cost
-		VertexList::iterator vertex_min_it = openSet.end();
-		Vertex *vertex_min = 0;
-		uint32 min = HUGE_DISTANCE;
-
-		for (VertexList::iterator it = openSet.begin(); it != openSet.end(); ++it) {
-			Vertex *vertex = *it;
-			if (vertex->costF < min) {
-				vertex_min_it = it;
-				vertex_min = *vertex_min_it;
-				min = vertex->costF;
-			}
-		}
+		Vertex *vertex_min = openSet.pop();
 
-		assert(vertex_min != 0);	// the vertex cost should never be bigger than HUGE_DISTANCE
+		// Skip entries of vertices whose cost has been lowered since
+		if (closedSet[vertex_min->idx])
+			continue;
 
 		// Check if we are done
-		if (vertex_min == s->vertex_end)
+		if (vertex_min == s->vertex_end) {
+			reachedEnd = true;
 			break;
+		}
 
 		// Move vertex from set open to set closed
-		closedSet.push_front(vertex_min);
-		openSet.erase(vertex_min_it);
+		closedSet[vertex_min->idx] = true;
 
 		VertexList *visVerts = visible_vertices(s, vertex_min);
 
@@ -1397,11 +1551,11 @@ static void AStar(PathfindingState *s) {
 			uint32 new_dist;
 			Vertex *vertex = *it;
 
-			if (closedSet.contains(vertex))
+			if (closedSet[vertex->idx])
 				continue;
 
-			if (!openSet.contains(vertex))
-				openSet.push_front(vertex);
+			if (!openSetOrder[vertex->idx])
+				openSetOrder[vertex->idx] = nextOrder++;
 
 			new_dist = vertex_min->costG + (uint32)sqrt((float)vertex_min->v.sqrDist(vertex->v));
 
@@ -1439,13 +1593,14 @@ static void AStar(PathfindingState *s) {
 				vertex->costG = new_dist;
 				vertex->costF = vertex->costG + (uint32)sqrt((float)vertex->v.sqrDist(s->vertex_end->v));
 				vertex->path_prev = vertex_min;
+				openSet.push(vertex, openSetOrder[vertex->idx]);
 			}
 		}
 
 		delete visVerts;
 	}
 
-	if (openSet.empty())
+	if (!reachedEnd)
 		debugC(kDebugLevelAvoidPath, "AvoidPath: End point (%i, %i) is unreachable", s->vertex_end->v.x, s->vertex_end->v.y);
 }
 
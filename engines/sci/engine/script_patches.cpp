@@ -18396,6 +18396,7 @@ ScriptPatcher::ScriptPatcher() {
 
 	_runtimeTable = NULL;
 	_isMacSci11 = false;
+	memset(_magicDWordFilter, 0, sizeof(_magicDWordFilter));
 }
 
 ScriptPatcher::~ScriptPatcher() {
@@ -18626,10 +18627,6 @@ int32 ScriptPatcher::findSignature(uint32 magicDWord, int magicOffset, const uin
 	return -1;
 }
 
-int32 ScriptPatcher::findSignature(const SciScriptPatcherEntry *patchEntry, const SciScriptPatcherRuntimeEntry *runtimeEntry, const SciSpan<const byte> &scriptData) {
-	return findSignature(runtimeEntry->magicDWord, runtimeEntry->magicOffset, patchEntry->signatureData, patchEntry->description, scriptData);
-}
-
 // Attention: Magic DWord is returned using platform specific byte order. This is done on purpose for performance.
 void ScriptPatcher::calculateMagicDWordAndVerify(const char *signatureDescription, const uint16 *signatureData, bool magicDWordIncluded, uint32 &calculatedMagicDWord, int &calculatedMagicDWordOffset) {
 	Selector curSelector = -1;
@@ -18792,10 +18789,39 @@ void ScriptPatcher::initSignature(const SciScriptPatcherEntry *patchTable) {
 		// We verify the patch data
 		calculateMagicDWordAndVerify(curEntry->description, curEntry->patchData, false, curRuntimeEntry->magicDWord, curRuntimeEntry->magicOffset);
 
+		// Index the entry, so that scripts get only scanned for their own signatures and only once
+		_scriptEntries[curEntry->scriptNr].push_back(curEntry - patchTable);
+		const uint32 magicDWordHash = hashMagicDWord(curRuntimeEntry->magicDWord);
+		_magicDWordFilter[magicDWordHash >> 5] |= 1u << (magicDWordHash & 31);
+
 		curEntry++; curRuntimeEntry++;
 	}
 }
 
+void ScriptPatcher::findMagicDWords(const Common::Array<uint16> &entries, uint firstEntry, const SciSpan<const byte> &scriptData, Common::Array<Common::Array<uint32> > &magicDWordOffsets) {
+	magicDWordOffsets.resize(entries.size());
+	for (uint i = firstEntry; i < entries.size(); i++)
+		magicDWordOffsets[i].clear();
+
+	if (scriptData.size() < 4) // we need to find a DWORD, so less than 4 bytes is not okay
+		return;
+
+	const byte *data = scriptData.getUnsafeDataAt(0, scriptData.size());
+	const uint32 searchLimit = scriptData.size() - 3;
+	for (uint32 DWordOffset = 0; DWordOffset < searchLimit; DWordOffset++) {
+		// magic DWords are in platform-specific BE/LE form, see calculateMagicDWordAndVerify()
+		const uint32 DWord = READ_UINT32(data + DWordOffset);
+		const uint32 DWordHash = hashMagicDWord(DWord);
+		if (!(_magicDWordFilter[DWordHash >> 5] & (1u << (DWordHash & 31))))
+			continue;
+
+		for (uint i = firstEntry; i < entries.size(); i++) {
+			if (_runtimeTable[entries[i]].magicDWord == DWord)
+				magicDWordOffsets[i].push_back(DWordOffset);
+		}
+	}
+}
+
 // This method enables certain patches
 //  It's used for patches, which are not meant to get applied all the time
 void ScriptPatcher::enablePatch(const SciScriptPatcherEntry *patchTable, const char *searchDescription) {
@@ -19063,24 +19089,54 @@ void ScriptPatcher::processScript(uint16 scriptNr, SciSpan<byte> scriptData) {
 			}
 		}
 
-		curEntry = signatureTable;
-		curRuntimeEntry = _runtimeTable;
-
-		while (curEntry->signatureData) {
-			if ((scriptNr == curEntry->scriptNr) && (curRuntimeEntry->active)) {
-				int32 foundOffset = 0;
-				int16 applyCount = curEntry->applyCount;
-				do {
-					foundOffset = findSignature(curEntry, curRuntimeEntry, scriptData);
-					if (foundOffset != -1) {
-						// found, so apply the patch
-						debugC(kDebugLevelPatcher, "Script-Patcher: '%s' on script %d offset %d", curEntry->description, scriptNr, foundOffset);
-						applyPatch(curEntry, scriptData, foundOffset);
+		Common::HashMap<uint16, Common::Array<uint16> >::const_iterator scriptEntries = _scriptEntries.find(scriptNr);
+		if (scriptEntries == _scriptEntries.end())
+			return;
+
+		Common::Array<uint16> activeEntries;
+		for (uint i = 0; i < scriptEntries->_value.size(); i++) {
+			if (_runtimeTable[scriptEntries->_value[i]].active)
+				activeEntries.push_back(scriptEntries->_value[i]);
+		}
+
+		// The script is scanned for the magic DWords of all its signatures at once. Patches
+		// are still applied in table order, and as applying one changes the script data,
+		// the remaining signatures get searched for again afterwards.
+		Common::Array<Common::Array<uint32> > magicDWordOffsets;
+		bool scanNeeded = true;
+
+		for (uint i = 0; i < activeEntries.size(); i++) {
+			curEntry = signatureTable + activeEntries[i];
+			curRuntimeEntry = _runtimeTable + activeEntries[i];
+
+			int32 foundOffset = 0;
+			int16 applyCount = curEntry->applyCount;
+			do {
+				if (scanNeeded) {
+					findMagicDWords(activeEntries, i, scriptData, magicDWordOffsets);
+					scanNeeded = false;
+				}
+
+				foundOffset = -1;
+				const Common::Array<uint32> &offsets = magicDWordOffsets[i];
+				for (uint j = 0; j < offsets.size(); j++) {
+					// magic DWORD found, check if actual signature matches
+					uint32 offset = offsets[j] + curRuntimeEntry->magicOffset;
+
+					if (verifySignature(offset, curEntry->signatureData, curEntry->description, scriptData)) {
+						foundOffset = offset;
+						break;
 					}
-					applyCount--;
-				} while ((foundOffset != -1) && (applyCount));
-			}
-			curEntry++; curRuntimeEntry++;
+				}
+
+				if (foundOffset != -1) {
+					// found, so apply the patch
+					debugC(kDebugLevelPatcher, "Script-Patcher: '%s' on script %d offset %d", curEntry->description, scriptNr, foundOffset);
+					applyPatch(curEntry, scriptData, foundOffset);
+					scanNeeded = true;
+				}
+				applyCount--;
+			} while ((foundOffset != -1) && (applyCount));
 		}
 	}
 }
@@ -23,6 +23,7 @@
 #ifndef SCI_ENGINE_SCRIPT_PATCHES_H
 #define SCI_ENGINE_SCRIPT_PATCHES_H
 
+#include "common/hashmap.h"
 #include "sci/sci.h"
 
 namespace Sci {
@@ -113,16 +114,27 @@ private:
 	// Enables a patch inside the patch table (used for optional patches like CD+Text support for KQ6 & LB2)
 	void enablePatch(const SciScriptPatcherEntry *patchTable, const char *searchDescription);
 
-	// Searches for a given signature entry inside script data
-	// returns -1 in case it was not found or an offset to the matching data
-	int32 findSignature(const SciScriptPatcherEntry *patchEntry, const SciScriptPatcherRuntimeEntry *runtimeEntry, const SciSpan<const byte> &scriptData);
-
 	// Applies a patch to a given script + offset (overwrites parts)
 	void applyPatch(const SciScriptPatcherEntry *patchEntry, SciSpan<byte> scriptData, int32 signatureOffset);
 
+	// Scans script data once for the magic DWords of the patch entries from firstEntry on
+	// and stores the offsets of all occurrences per entry inside magicDWordOffsets
+	void findMagicDWords(const Common::Array<uint16> &entries, uint firstEntry, const SciSpan<const byte> &scriptData, Common::Array<Common::Array<uint32> > &magicDWordOffsets);
+
+	static uint32 hashMagicDWord(uint32 magicDWord) { return (magicDWord * 0x9E3779B1) >> (32 - kMagicDWordFilterBits); }
+
+	enum {
+		kMagicDWordFilterBits = 16
+	};
+
 	Selector *_selectorIdTable;
 	SciScriptPatcherRuntimeEntry *_runtimeTable;
 	bool _isMacSci11;
+
+	// Patch table indices of the entries of each script, built by initSignature()
+	Common::HashMap<uint16, Common::Array<uint16> > _scriptEntries;
+	// Bit set of the hashed magic DWords of the patch table, so most script offsets are rejected by a single lookup
+	uint32 _magicDWordFilter[(1 << kMagicDWordFilterBits) / 32];
 };
 
 } // End of namespace Sci
@@ -48,6 +48,8 @@ SegManager::SegManager(ResourceManager *resMan, ScriptPatcher *scriptPatcher)
 	_bitmapSegId = 0;
 #endif
 
+	_allocationsSinceGC = 0;
+
 	createClassTable();
 }
 
@@ -80,6 +82,9 @@ void SegManager::resetSegMan() {
 	// Reinitialize class table
 	_classTable.clear();
 	createClassTable();
+
+	_selectorLookupCache.clear();
+	_allocationsSinceGC = 0;
 }
 
 void SegManager::initSysStrings() {
@@ -167,6 +172,7 @@ void SegManager::deallocate(SegmentId seg) {
 	if (mobj->getType() == SEG_TYPE_SCRIPT) {
 		Script *scr = (Script *)mobj;
 		_scriptSegMap.erase(scr->getScriptNumber());
+		_selectorLookupCache.clear();
 		if (scr->getLocalsSegment()) {
 			// Check if the locals segment has already been deallocated.
 			// If the locals block has been stored in a segment with an ID
@@ -403,6 +409,7 @@ reg_t SegManager::allocateHunkEntry(const char *hunk_type, int size) {
 	table = (HunkTable *)_heap[_hunksSegId];
 
 	offset = table->allocEntry();
+	++_allocationsSinceGC;
 
 	reg_t addr = make_reg(_hunksSegId, offset);
 	Hunk *h = &table->at(offset);
@@ -438,6 +445,7 @@ Clone *SegManager::allocateClone(reg_t *addr) {
 		table = (CloneTable *)_heap[_clonesSegId];
 
 	offset = table->allocEntry();
+	++_allocationsSinceGC;
 
 	*addr = make_reg(_clonesSegId, offset);
 	return &table->at(offset);
@@ -452,6 +460,7 @@ List *SegManager::allocateList(reg_t *addr) {
 	table = (ListTable *)_heap[_listsSegId];
 
 	offset = table->allocEntry();
+	++_allocationsSinceGC;
 
 	*addr = make_reg(_listsSegId, offset);
 	return &table->at(offset);
@@ -466,6 +475,7 @@ Node *SegManager::allocateNode(reg_t *addr) {
 	table = (NodeTable *)_heap[_nodesSegId];
 
 	offset = table->allocEntry();
+	++_allocationsSinceGC;
 
 	*addr = make_reg(_nodesSegId, offset);
 	return &table->at(offset);
@@ -851,6 +861,7 @@ byte *SegManager::allocDynmem(int size, const char *descr, reg_t *addr) {
 	SegmentId seg;
 	SegmentObj *mobj = allocSegment(new DynMem(), &seg);
 	*addr = make_reg(seg, 0);
+	++_allocationsSinceGC;
 
 	DynMem &d = *(DynMem *)mobj;
 
@@ -893,6 +904,7 @@ SciArray *SegManager::allocateArray(SciArrayType type, uint16 size, reg_t *addr)
 		table = (ArrayTable *)_heap[_arraysSegId];
 
 	offset = table->allocEntry();
+	++_allocationsSinceGC;
 
 	*addr = make_reg(_arraysSegId, offset);
 
@@ -949,6 +961,7 @@ SciBitmap *SegManager::allocateBitmap(reg_t *addr, const int16 width, const int1
 	}
 
 	offset = table->allocEntry();
+	++_allocationsSinceGC;
 
 	*addr = make_reg(_bitmapSegId, offset);
 	SciBitmap &bitmap = table->at(offset);
@@ -1046,6 +1059,7 @@ int SegManager::instantiateScript(int scriptNum, bool applyScriptPatches) {
 	scr->initializeLocals(this);
 	scr->initializeClasses(this);
 	scr->initializeObjects(this, segmentId, applyScriptPatches);
+	_selectorLookupCache.clear();
 #ifdef ENABLE_SCI32
 	g_sci->_guestAdditions->instantiateScriptHook(*scr);
 #endif
@@ -1080,6 +1094,8 @@ void SegManager::uninstantiateScript(int script_nr) {
 	if (!scr->getLockers()) {
 		// The actual script deletion seems to be done by SCI scripts themselves
 		scr->markDeleted();
+		_selectorLookupCache.clear();
+		++_allocationsSinceGC;
 		debugC(kDebugLevelScripts, "Unloaded script 0x%x.", script_nr);
 	}
 }
@@ -458,6 +458,17 @@ public:
 
 	const Common::Array<SegmentObj *> &getSegments() const { return _heap; }
 
+	/** Cache used by lookupSelector(). */
+	SelectorLookupCache &getSelectorLookupCache() { return _selectorLookupCache; }
+
+	/**
+	 * Number of heap objects allocated and scripts unloaded since the last
+	 * garbage collection. Without either, a collection can not reclaim any
+	 * memory which was not already reclaimable at the previous one.
+	 */
+	uint32 getAllocationsSinceGC() const { return _allocationsSinceGC; }
+	void resetAllocationsSinceGC() { _allocationsSinceGC = 0; }
+
 private:
 	Common::Array<SegmentObj *> _heap;
 	Common::Array<Class> _classTable; /**< Table of all classes */
@@ -481,6 +492,9 @@ private:
 	SegmentId _bitmapSegId;
 #endif
 
+	SelectorLookupCache _selectorLookupCache;
+	uint32 _allocationsSinceGC;
+
 public:
 	SegmentObj *allocSegment(SegmentObj *mem, SegmentId *segid);
 
@@ -20,6 +20,8 @@
  *
  */
 
+#include "common/system.h"
+
 #include "sci/sci.h"
 #include "sci/engine/features.h"
 #include "sci/engine/kernel.h"
@@ -340,34 +342,69 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector sel
 		error("lookupSelector: Attempt to send to non-object or invalid script. Address %04x:%04x, %s", PRINT_REG(obj_location), origin.toString().c_str());
 	}
 
-	index = obj->locateVarSelector(segMan, selectorId);
-
-	if (index >= 0) {
-		// Found it as a variable
-		if (varp) {
-			varp->obj = obj_location;
-			varp->varindex = index;
-		}
-		return kSelectorVariable;
-	} else {
-		// Check if it's a method, with recursive lookup in superclasses
-		while (obj) {
-			index = obj->funcSelectorPosition(selectorId);
-			if (index >= 0) {
-				if (fptr)
-					*fptr = obj->getFunction(index);
-
-				return kSelectorMethod;
-			} else {
-				obj = segMan->getObject(obj->getSuperClassSelector());
+	SelectorLookupCache &cache = segMan->getSelectorLookupCache();
+	SelectorLookupCache::Entry &entry = cache.getEntry(obj->getPos(), selectorId);
+	cache._stats.lookups++;
+
+	if (entry.pos != obj->getPos() || entry.selector != selectorId) {
+		entry.pos = obj->getPos();
+		entry.selector = selectorId;
+		entry.type = kSelectorNone;
+		entry.varIndex = obj->locateVarSelector(segMan, selectorId);
+
+		if (entry.varIndex >= 0) {
+			// Found it as a variable
+			entry.type = kSelectorVariable;
+		} else {
+			// Check if it's a method, with recursive lookup in superclasses
+			while (obj) {
+				index = obj->funcSelectorPosition(selectorId);
+				if (index >= 0) {
+					entry.type = kSelectorMethod;
+					entry.func = obj->getFunction(index);
+					break;
+				} else {
+					obj = segMan->getObject(obj->getSuperClassSelector());
+				}
 			}
 		}
+	} else {
+		cache._stats.hits++;
+	}
 
-		return kSelectorNone;
+	if (entry.type == kSelectorVariable && varp) {
+		varp->obj = obj_location;
+		varp->varindex = entry.varIndex;
+	} else if (entry.type == kSelectorMethod && fptr) {
+		*fptr = entry.func;
 	}
 
+	return entry.type;
+}
+
+SelectorLookupCache::SelectorLookupCache() {
+	invalidateEntries();
+	resetStatistics();
+}
+
+void SelectorLookupCache::clear() {
+	invalidateEntries();
+	_stats.clears++;
+}
+
+void SelectorLookupCache::invalidateEntries() {
+	for (int i = 0; i < kEntryCount; ++i) {
+		_entries[i].pos = NULL_REG;
+		_entries[i].selector = -1;
+	}
+}
 
-//	return _lookupSelector_function(segMan, obj, selectorId, fptr);
+void SelectorLookupCache::resetStatistics() {
+	_stats.sends = 0;
+	_stats.lookups = 0;
+	_stats.hits = 0;
+	_stats.clears = 0;
+	_stats.startTime = g_system->getMillis(true);
 }
 
 } // End of namespace Sci
@@ -100,6 +100,7 @@ void EngineState::reset(bool isRestoring) {
 	lastWaitTime = 0;
 
 	gcCountDown = 0;
+	_gcStats.reset();
 
 #ifdef ENABLE_SCI32
 	_eventCounter = 0;
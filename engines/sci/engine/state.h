@@ -98,6 +98,40 @@ struct SciCallOrigin {
 	}
 };
 
+/**
+ * Visibility graph of the polygon set last passed to kAvoidPath, see
+ * kpathing.cpp. Rows are filled in on demand.
+ */
+struct AvoidPathCache {
+	/** Types, sizes and points of the polygons the graph belongs to */
+	Common::Array<int16> polygons;
+	/** For every polygon vertex the ascending indices of the visible vertices */
+	Common::Array<Common::Array<uint16> > visibility;
+	/** Whether the corresponding row of visibility has been computed */
+	Common::Array<bool> rowComputed;
+};
+
+/**
+ * Pause times and yield of the garbage collector, see run_gc(). All times
+ * are in microseconds.
+ */
+struct GCStatistics {
+	uint32 runs;         /**< Number of collections */
+	uint32 skipped;      /**< Number of periodic collections skipped because nothing was allocated */
+	uint32 lastPause;
+	uint32 maxPause;
+	uint64 totalPause;
+	uint32 lastFreed;    /**< Number of objects freed by the last collection */
+	uint32 totalFreed;
+
+	void reset() {
+		runs = skipped = 0;
+		lastPause = maxPause = 0;
+		totalPause = 0;
+		lastFreed = totalFreed = 0;
+	}
+};
+
 struct EngineState : public Common::Serializable {
 public:
 	EngineState(SegManager *segMan);
@@ -190,9 +224,12 @@ public:
 	void shrinkStackToBase();
 
 	int gcCountDown; /**< Number of kernel calls until next gc */
+	GCStatistics _gcStats;
 
 	MessageState *_msgState;
 
+	AvoidPathCache _avoidPathCache;
+
 	// MemorySegment provides access to a 256-byte block of memory that remains
 	// intact across restarts and restores
 	enum {
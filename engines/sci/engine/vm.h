@@ -399,6 +399,61 @@ void script_debug(EngineState *s);
 SelectorType lookupSelector(SegManager *segMan, reg_t obj, Selector selectorid,
 		ObjVarRef *varp, reg_t *fptr);
 
+/**
+ * Cache of lookupSelector() results.
+ *
+ * Entries are indexed by the position of the object which defines the
+ * variable and method tables, i.e. Object::getPos(). Clones keep the position
+ * of the object they were cloned from (see kClone), so all clones of an object
+ * share its entries. Since the superclass chain of an object depends on the
+ * loaded scripts, the cache is cleared whenever a script is loaded or unloaded.
+ */
+class SelectorLookupCache {
+public:
+	struct Entry {
+		reg_t pos;
+		Selector selector;
+		SelectorType type;
+		int varIndex;
+		reg_t func;
+	};
+
+	struct Statistics {
+		uint32 sends;       ///< Selectors sent by the send opcodes
+		uint32 lookups;     ///< Calls of lookupSelector()
+		uint32 hits;        ///< Lookups answered from the cache
+		uint32 clears;      ///< Number of times the cache was cleared
+		uint32 startTime;   ///< Time in ms when the statistics were reset
+	};
+
+	SelectorLookupCache();
+
+	/** Invalidate all entries. */
+	void clear();
+
+	/**
+	 * Get the slot for an object position and a selector. The slot holds the
+	 * cached result if its pos and selector match, otherwise it can be
+	 * overwritten with a new result.
+	 */
+	Entry &getEntry(reg_t pos, Selector selector) {
+		return _entries[(pos.getSegment() * 0x9E5 ^ pos.getOffset() * 0x1F ^ selector) & (kEntryCount - 1)];
+	}
+
+	void resetStatistics();
+
+	Statistics _stats;
+
+private:
+	enum {
+		kEntryCount = 4096
+	};
+
+	void invalidateEntries();
+
+	Entry _entries[kEntryCount];
+};
+
 /**
  * Read a PMachine instruction from a memory buffer and return its length.
  *
@@ -25,6 +25,7 @@
 #include "sci/engine/seg_manager.h"
 #include "sci/engine/state.h"
 #include "sci/graphics/celobj32.h"
+#include "sci/graphics/celrows32.h"
 #include "sci/graphics/frameout.h"
 #include "sci/graphics/palette32.h"
 #include "sci/graphics/remap32.h"
@@ -112,6 +113,8 @@ struct SCALER_NoScale {
 	const int16 _lastIndex;
 	const int16 _sourceX;
 	const int16 _sourceY;
+	// Mirrored rows get copied here, so they can be read front to back
+	byte _buffer[FLIP ? kCelScalerTableSize : 1];
 
 	SCALER_NoScale(const CelObj &celObj, const int16 maxWidth, const Common::Point &scaledPosition) :
 	_row(nullptr),
@@ -138,13 +141,21 @@ struct SCALER_NoScale {
 		}
 	}
 
-	inline byte read() {
-		assert(_row != _rowEdge);
-
+	/**
+	 * Reads the next width pixels of the target row. The returned pointer
+	 * is only valid until the next call.
+	 */
+	inline const byte *readRow(const int16 width) {
 		if (FLIP) {
-			return *_row--;
+			assert(_row - width >= _rowEdge);
+			copyCelRowMirrored(_buffer, _row, width);
+			_row -= width;
+			return _buffer;
 		} else {
-			return *_row++;
+			assert(_row + width <= _rowEdge);
+			const byte *row = _row;
+			_row += width;
+			return row;
 		}
 	}
 };
@@ -161,6 +172,8 @@ struct SCALER_Scale {
 	// image and takes precedence over _reader.
 	Common::SharedPtr<Buffer> _sourceBuffer;
 	int16 _x;
+	int16 _sourceY;
+	CelRowScaleCache<kCelScalerTableSize> _rowCache;
 	static int16 _valuesX[kCelScalerTableSize];
 	static int16 _valuesY[kCelScalerTableSize];
 
@@ -174,7 +187,8 @@ struct SCALER_Scale {
 	// data it requires if downscaling, so just always make the reader
 	// decompress an entire line of source data when scaling
 	_reader(celObj, celObj._width),
-	_sourceBuffer() {
+	_sourceBuffer(),
+	_sourceY(-1) {
 #ifndef NDEBUG
 		assert(_minX <= _maxX);
 #endif
@@ -292,16 +306,23 @@ struct SCALER_Scale {
 	}
 
 	inline void setTarget(const int16 x, const int16 y) {
+		_sourceY = _valuesY[y];
 		_row = _sourceBuffer
-			? static_cast<const byte *>( _sourceBuffer->getBasePtr(0, _valuesY[y]))
-			: _reader.getRow(_valuesY[y]);
+			? static_cast<const byte *>( _sourceBuffer->getBasePtr(0, _sourceY))
+			: _reader.getRow(_sourceY);
 		_x = x;
 		assert(_x >= _minX && _x <= _maxX);
 	}
 
-	inline byte read() {
-		assert(_x >= _minX && _x <= _maxX);
-		return _row[_valuesX[_x++]];
+	/**
+	 * Reads the next width pixels of the target row. The returned pointer
+	 * is only valid until the next call.
+	 */
+	inline const byte *readRow(const int16 width) {
+		assert(_x >= _minX && _x + width - 1 <= _maxX);
+		const byte *row = _rowCache.getRow(_row, _sourceY, _valuesX, _x, width);
+		_x += width;
+		return row;
 	}
 };
 
@@ -441,10 +462,8 @@ public:
  * remapping data.
  */
 struct MAPPER_NoMD {
-	inline void draw(byte *target, const byte pixel, const uint8 skipColor) const {
-		if (pixel != skipColor) {
-			*target = pixel;
-		}
+	inline void drawRow(byte *target, const byte *source, const int16 width, const uint8 skipColor) const {
+		copyCelRowSkip(target, source, width, skipColor);
 	}
 };
 
@@ -453,8 +472,8 @@ struct MAPPER_NoMD {
  * no remapping data.
  */
 struct MAPPER_NoMDNoSkip {
-	inline void draw(byte *target, const byte pixel, const uint8) const {
-		*target = pixel;
+	inline void drawRow(byte *target, const byte *source, const int16 width, const uint8) const {
+		memcpy(target, source, width);
 	}
 };
 
@@ -463,14 +482,19 @@ struct MAPPER_NoMDNoSkip {
  * remapping data, and remapping enabled.
  */
 struct MAPPER_Map {
-	inline void draw(byte *target, const byte pixel, const uint8 skipColor) const {
-		if (pixel != skipColor) {
-			// For some reason, SSCI never checks if the source pixel is *above*
-			// the range of remaps, so we do not either.
-			if (pixel < g_sci->_gfxRemap32->getStartColor()) {
-				*target = pixel;
-			} else if (g_sci->_gfxRemap32->remapEnabled(pixel)) {
-				*target = g_sci->_gfxRemap32->remapColor(pixel, *target);
+	inline void drawRow(byte *target, const byte *source, const int16 width, const uint8 skipColor) const {
+		GfxRemap32 *remap = g_sci->_gfxRemap32;
+		const uint8 startColor = remap->getStartColor();
+		for (int16 x = 0; x < width; ++x) {
+			const byte pixel = source[x];
+			if (pixel != skipColor) {
+				// For some reason, SSCI never checks if the source pixel is *above*
+				// the range of remaps, so we do not either.
+				if (pixel < startColor) {
+					target[x] = pixel;
+				} else if (remap->remapEnabled(pixel)) {
+					target[x] = remap->remapColor(pixel, target[x]);
+				}
 			}
 		}
 	}
@@ -481,12 +505,10 @@ struct MAPPER_Map {
  * remapping data, and remapping disabled.
  */
 struct MAPPER_NoMap {
-	inline void draw(byte *target, const byte pixel, const uint8 skipColor) const {
+	inline void drawRow(byte *target, const byte *source, const int16 width, const uint8 skipColor) const {
 		// For some reason, SSCI never checks if the source pixel is *above* the
 		// range of remaps, so we do not either.
-		if (pixel != skipColor && pixel < g_sci->_gfxRemap32->getStartColor()) {
-			*target = pixel;
-		}
+		copyCelRowNoRemap(target, source, width, skipColor, g_sci->_gfxRemap32->getStartColor());
 	}
 };
 
@@ -733,12 +755,9 @@ struct RENDERER {
 			}
 
 			_scaler.setTarget(targetRect.left, targetRect.top + y);
+			_mapper.drawRow(targetPixel, _scaler.readRow(targetWidth), targetWidth, _skipColor);
 
-			for (int16 x = 0; x < targetWidth; ++x) {
-				_mapper.draw(targetPixel++, _scaler.read(), _skipColor);
-			}
-
-			targetPixel += skipStride;
+			targetPixel += targetWidth + skipStride;
 		}
 	}
 };
@@ -0,0 +1,134 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef SCI_GRAPHICS_CELROWS32_H
+#define SCI_GRAPHICS_CELROWS32_H
+
+#include "common/endian.h"
+#include "common/textconsole.h"
+#include "common/scummsys.h"
+
+namespace Sci {
+
+/**
+ * Copies a row of cel pixels to the target, leaving target pixels untouched
+ * where the source pixel has the skip color.
+ *
+ * Pixels are tested four at a time, so runs of fully opaque or fully
+ * transparent pixels only cost one comparison per four pixels.
+ */
+inline void copyCelRowSkip(byte *target, const byte *source, const int16 width, const uint8 skipColor) {
+	const uint32 skipPattern = (uint32)skipColor * 0x01010101u;
+
+	int16 x = 0;
+	for (; x + 4 <= width; x += 4) {
+		const uint32 pixels = READ_UINT32(source + x);
+		// Bytes of this are zero exactly where the source has the skip color
+		const uint32 opaque = pixels ^ skipPattern;
+
+		if (((opaque - 0x01010101) & ~opaque & 0x80808080) == 0) {
+			WRITE_UINT32(target + x, pixels);
+		} else if (opaque != 0) {
+			for (int i = 0; i < 4; ++i) {
+				if (source[x + i] != skipColor) {
+					target[x + i] = source[x + i];
+				}
+			}
+		}
+	}
+
+	for (; x < width; ++x) {
+		if (source[x] != skipColor) {
+			target[x] = source[x];
+		}
+	}
+}
+
+/**
+ * Copies a row of cel pixels to the target, leaving target pixels untouched
+ * where the source pixel has the skip color or is a remap color, i.e. is at
+ * or above remapStartColor.
+ */
+inline void copyCelRowNoRemap(byte *target, const byte *source, const int16 width, const uint8 skipColor, const uint8 remapStartColor) {
+	for (int16 x = 0; x < width; ++x) {
+		const byte pixel = source[x];
+		if (pixel != skipColor && pixel < remapStartColor) {
+			target[x] = pixel;
+		}
+	}
+}
+
+/**
+ * Copies a row of cel pixels to the target in reverse order, reading the
+ * source backwards from the given pixel.
+ */
+inline void copyCelRowMirrored(byte *target, const byte *source, const int16 width) {
+	for (int16 x = 0; x < width; ++x) {
+		target[x] = *source--;
+	}
+}
+
+/**
+ * Gathers the pixels of scaled cel rows.
+ *
+ * When upscaling, consecutive target rows often come from the same source
+ * row. The last gathered row is kept and returned again as long as the
+ * source row and the requested range of target pixels are the same.
+ */
+template<int SIZE>
+class CelRowScaleCache {
+public:
+	CelRowScaleCache() : _sourceY(-1), _x(-1), _width(0) {}
+
+	/**
+	 * Gets target pixels x to x + width - 1 of a scaled row. The returned
+	 * pointer is only valid until the next call.
+	 *
+	 * @param sourceRow The source row
+	 * @param sourceY   The index of the source row
+	 * @param valuesX   The source pixel of every target pixel. It must not
+	 *                  change during the lifetime of the cache.
+	 */
+	const byte *getRow(const byte *sourceRow, const int16 sourceY, const int16 *valuesX, const int16 x, const int16 width) {
+		assert(width <= SIZE);
+		if (sourceY != _sourceY || x != _x || width != _width) {
+			valuesX += x;
+			for (int16 i = 0; i < width; ++i) {
+				_buffer[i] = sourceRow[valuesX[i]];
+			}
+			_sourceY = sourceY;
+			_x = x;
+			_width = width;
+		}
+		return _buffer;
+	}
+
+private:
+	byte _buffer[SIZE];
+	int16 _sourceY;
+	int16 _x;
+	int16 _width;
+};
+
+} // End of namespace Sci
+
+#endif
@@ -42,6 +42,137 @@ void DrawList::add(ScreenItem *screenItem, const Common::Rect &rect) {
 	DrawListBase::add(drawItem);
 }
 
+#pragma mark -
+#pragma mark ScreenItemGrid
+
+/**
+ * Buckets the screen items of a plane by their screen rects, so that the
+ * items which may intersect a rect can be found without testing all of them.
+ * Items are always returned in list order, so using the grid does not change
+ * the order in which items get added to draw lists.
+ */
+class ScreenItemGrid {
+public:
+	ScreenItemGrid(const Common::Rect &bounds, const ScreenItemList &screenItemList, const ScreenItemList::size_type screenItemCount);
+
+	/**
+	 * Gets the ascending list indices of all items whose screen rects may
+	 * intersect the given rect.
+	 */
+	const Common::Array<uint16> &findItems(const Common::Rect &rect);
+
+private:
+	enum {
+		kMaxCellsPerAxis = 8,
+		/** Below this many items, the grid has only a single cell */
+		kMinItemsForGrid = 16
+	};
+
+	void build();
+	void getCellRange(const Common::Rect &rect, int &left, int &top, int &right, int &bottom) const;
+
+	Common::Rect _bounds;
+	const ScreenItemList &_screenItemList;
+	bool _built;
+	int _cellsPerAxis;
+	ScreenItemList::size_type _screenItemCount;
+	Common::Array<uint16> _cells[kMaxCellsPerAxis * kMaxCellsPerAxis];
+	/** Items whose screen rect is inverted, these are checked for any rect */
+	Common::Array<uint16> _unboundedItems;
+
+	Common::Array<uint16> _result;
+	Common::Array<byte> _inResult;
+};
+
+ScreenItemGrid::ScreenItemGrid(const Common::Rect &bounds, const ScreenItemList &screenItemList, const ScreenItemList::size_type screenItemCount) :
+	_bounds(bounds),
+	_screenItemList(screenItemList),
+	_built(false),
+	_screenItemCount(screenItemCount) {
+	_cellsPerAxis = (screenItemCount < kMinItemsForGrid || bounds.isEmpty()) ? 1 : kMaxCellsPerAxis;
+}
+
+void ScreenItemGrid::build() {
+	_built = true;
+	if (_cellsPerAxis == 1) {
+		return;
+	}
+
+	_inResult.resize(_screenItemCount);
+	for (ScreenItemList::size_type i = 0; i < _screenItemCount; ++i) {
+		const ScreenItem *item = _screenItemList[i];
+		if (item == nullptr) {
+			continue;
+		}
+
+		const Common::Rect &itemRect = item->_screenRect;
+		if (itemRect.left >= itemRect.right || itemRect.top >= itemRect.bottom) {
+			_unboundedItems.push_back(i);
+			continue;
+		}
+
+		int left, top, right, bottom;
+		getCellRange(itemRect, left, top, right, bottom);
+		for (int y = top; y <= bottom; ++y) {
+			for (int x = left; x <= right; ++x) {
+				_cells[y * _cellsPerAxis + x].push_back(i);
+			}
+		}
+	}
+}
+
+void ScreenItemGrid::getCellRange(const Common::Rect &rect, int &left, int &top, int &right, int &bottom) const {
+	// Coordinates outside of the bounds go to the outermost cells, which keeps
+	// rects that overlap each other in overlapping cell ranges
+	const int width = _bounds.width();
+	const int height = _bounds.height();
+	left = CLIP<int>((rect.left - _bounds.left) * _cellsPerAxis / width, 0, _cellsPerAxis - 1);
+	right = CLIP<int>((rect.right - 1 - _bounds.left) * _cellsPerAxis / width, 0, _cellsPerAxis - 1);
+	top = CLIP<int>((rect.top - _bounds.top) * _cellsPerAxis / height, 0, _cellsPerAxis - 1);
+	bottom = CLIP<int>((rect.bottom - 1 - _bounds.top) * _cellsPerAxis / height, 0, _cellsPerAxis - 1);
+}
+
+const Common::Array<uint16> &ScreenItemGrid::findItems(const Common::Rect &rect) {
+	_result.clear();
+
+	if (!_built) {
+		build();
+	}
+
+	if (_cellsPerAxis == 1 || rect.left >= rect.right || rect.top >= rect.bottom) {
+		for (ScreenItemList::size_type i = 0; i < _screenItemCount; ++i) {
+			_result.push_back(i);
+		}
+		return _result;
+	}
+
+	int left, top, right, bottom;
+	getCellRange(rect, left, top, right, bottom);
+	for (int y = top; y <= bottom; ++y) {
+		for (int x = left; x <= right; ++x) {
+			const Common::Array<uint16> &cell = _cells[y * _cellsPerAxis + x];
+			for (uint i = 0; i < cell.size(); ++i) {
+				if (!_inResult[cell[i]]) {
+					_inResult[cell[i]] = true;
+					_result.push_back(cell[i]);
+				}
+			}
+		}
+	}
+	for (uint i = 0; i < _unboundedItems.size(); ++i) {
+		if (!_inResult[_unboundedItems[i]]) {
+			_inResult[_unboundedItems[i]] = true;
+			_result.push_back(_unboundedItems[i]);
+		}
+	}
+
+	for (uint i = 0; i < _result.size(); ++i) {
+		_inResult[_result[i]] = false;
+	}
+	Common::sort(_result.begin(), _result.end());
+	return _result;
+}
+
 #pragma mark -
 #pragma mark Plane
 uint16 Plane::_nextObjectId; // Will be initialized in Plane::init()
@@ -431,6 +562,10 @@ void Plane::calcLists(Plane &visiblePlane, const PlaneList &planeList, DrawList
 	DrawList::size_type drawListSizePrimary = drawList.size();
 	const RectList::size_type eraseListCount = eraseList.size();
 
+	// Screen rects do not change anymore from here on, the grid gets built
+	// when it is first needed
+	ScreenItemGrid grid(_screenRect, _screenItemList, MIN<ScreenItemList::size_type>(screenItemCount, _screenItemList.size()));
+
 	if (getSciVersion() == SCI_VERSION_3) {
 		_screenItemList.sort();
 		bool pictureDrawn = false;
@@ -478,7 +613,9 @@ void Plane::calcLists(Plane &visiblePlane, const PlaneList &planeList, DrawList
 		// Add all items overlapping the erase list to the draw list
 		for (RectList::size_type i = 0; i < eraseListCount; ++i) {
 			const Common::Rect &rect = *eraseList[i];
-			for (ScreenItemList::size_type j = 0; j < screenItemCount; ++j) {
+			const Common::Array<uint16> &items = grid.findItems(rect);
+			for (uint k = 0; k < items.size(); ++k) {
+				const ScreenItemList::size_type j = items[k];
 				ScreenItem *item = _screenItemList[j];
 				if (
 					item != nullptr &&
@@ -504,11 +641,14 @@ void Plane::calcLists(Plane &visiblePlane, const PlaneList &planeList, DrawList
 				drawListEntry = drawList[i];
 			}
 
-			for (ScreenItemList::size_type j = 0; j < screenItemCount; ++j) {
-				ScreenItem *newItem = nullptr;
-				if (j < _screenItemList.size()) {
-					newItem = _screenItemList[j];
-				}
+			if (drawListEntry == nullptr) {
+				continue;
+			}
+
+			const Common::Array<uint16> &items = grid.findItems(drawListEntry->rect);
+			for (uint k = 0; k < items.size(); ++k) {
+				const ScreenItemList::size_type j = items[k];
+				ScreenItem *newItem = _screenItemList[j];
 
 				if (
 					drawListEntry != nullptr && newItem != nullptr &&
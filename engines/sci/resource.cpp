@@ -25,6 +25,7 @@
 #include "common/file.h"
 #include "common/fs.h"
 #include "common/macresman.h"
+#include "common/system.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
 #ifdef ENABLE_SCI32
@@ -915,7 +916,7 @@ void ChunkResourceSource::scanSource(ResourceManager *resMan) {
 		_resMap[id] = entry;
 		ptr += 11;
 
-		debugC(kDebugLevelResMan, 2, "Found %s in chunk %d", id.toString().c_str(), _number);
+		debugC(2, kDebugLevelResMan, "Found %s in chunk %d", id.toString().c_str(), _number);
 
 		resMan->updateResource(id, this, entry.length, chunk->_source->getLocationName());
 
@@ -981,6 +982,7 @@ void ResourceManager::init() {
 	_memoryLocked = 0;
 	_memoryLRU = 0;
 	_LRU.clear();
+	_prefetchQueue.clear();
 	_resMap.clear();
 	_audioMapSCI1 = NULL;
 #ifdef ENABLE_SCI32
@@ -1224,7 +1226,7 @@ void ResourceManager::unlockResource(Resource *res) {
 	assert(res);
 
 	if (res->_status != kResStatusLocked) {
-		debugC(kDebugLevelResMan, 2, "[resMan] Attempt to unlock unlocked resource %s", res->_id.toString().c_str());
+		debugC(2, kDebugLevelResMan, "[resMan] Attempt to unlock unlocked resource %s", res->_id.toString().c_str());
 		return;
 	}
 
@@ -1237,6 +1239,46 @@ void ResourceManager::unlockResource(Resource *res) {
 	freeOldResources();
 }
 
+void ResourceManager::queuePrefetch(ResourceId id) {
+	const Resource *res = testResource(id);
+	if (!res || res->_status != kResStatusNoMalloc)
+		return;
+
+	for (Common::List<ResourceId>::const_iterator it = _prefetchQueue.begin(); it != _prefetchQueue.end(); ++it) {
+		if (*it == id)
+			return;
+	}
+	_prefetchQueue.push_back(id);
+}
+
+bool ResourceManager::prefetch(uint32 maxMillis) {
+	if (_prefetchQueue.empty())
+		return false;
+
+	const uint32 startTime = g_system->getMillis();
+	bool loaded = false;
+	do {
+		Resource *res = testResource(_prefetchQueue.front());
+		_prefetchQueue.pop_front();
+
+		// The resource may have been used since it was queued
+		if (!res || res->_status != kResStatusNoMalloc)
+			continue;
+
+		loadResource(res);
+		if (res->_status == kResStatusAllocated) {
+			// Like any other resource which is not locked, the resource is
+			// put under LRU control until somebody finds it
+			addToLRU(res);
+			freeOldResources();
+			loaded = true;
+			debugC(2, kDebugLevelResMan, "[resMan] Prefetched %s", res->_id.toString().c_str());
+		}
+	} while (!_prefetchQueue.empty() && g_system->getMillis() - startTime < maxMillis);
+
+	return loaded;
+}
+
 const char *ResourceManager::versionDescription(ResVersion version) const {
 	switch (version) {
 	case kResVersionUnknown:
@@ -369,6 +369,23 @@ public:
 	 */
 	void unlockResource(Resource *res);
 
+	/**
+	 * Queues a resource to be loaded ahead of its first use by prefetch().
+	 * Resources which do not exist or are already loaded are ignored.
+	 * @param id	The resource to load
+	 */
+	void queuePrefetch(ResourceId id);
+
+	/**
+	 * Loads queued resources into the LRU cache, so that a later findResource()
+	 * does not need to read and decompress them. Loading stops once the given
+	 * time has passed; a single resource is always loaded completely.
+	 * Meant to be called while the engine is waiting anyway.
+	 * @param maxMillis	Time that may be spent loading
+	 * @return true if any resource was loaded
+	 */
+	bool prefetch(uint32 maxMillis);
+
 	/**
 	 * Tests whether a resource exists.
 	 *
@@ -488,6 +505,7 @@ protected:
 	int _memoryLocked;	///< Amount of resource bytes in locked memory
 	int _memoryLRU;		///< Amount of resource bytes under LRU control
 	Common::List<Resource *> _LRU; ///< Last Resource Used list
+	Common::List<ResourceId> _prefetchQueue; ///< Resources to load by prefetch()
 	ResourceMap _resMap;
 	Common::List<Common::File *> _volumeFiles; ///< list of opened volume files
 	ResourceSource *_audioMapSCI1; ///< Currently loaded audio map for SCI1
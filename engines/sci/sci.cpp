@@ -911,6 +911,9 @@ void SciEngine::sleep(uint32 msecs) {
 #endif
 		time = g_system->getMillis();
 		if (time + 10 < wakeUpTime) {
+			// Use the time to load resources which the game is about to need
+			if (_resMan->prefetch(wakeUpTime - time - 10))
+				continue;
 			g_system->delayMillis(10);
 		} else {
 			if (time < wakeUpTime)
@@ -338,6 +338,7 @@ void AkosRenderer::setPalette(uint16 *new_palette) {
 void AkosRenderer::setCostume(int costume, int shadow) {
 	const byte *akos = _vm->getResourceAddress(rtCostume, costume);
 	assert(akos);
+	_costumeId = costume;
 
 	akhd = (const AkosHeader *) _vm->findResourceData(MKTAG('A','K','H','D'), akos);
 	akof = (const AkosOffset *) _vm->findResourceData(MKTAG('A','K','O','F'), akos);
@@ -544,11 +545,17 @@ void AkosRenderer::codec1_genericDecode(Codec1 &v1) {
 	byte *dst;
 	byte len, maskbit;
 	int y;
-	uint16 color, height, pcolor;
+	uint16 color, height;
 	const byte *scaleytab;
 	bool masked;
 	bool skip_column = false;
 
+	const DecodedCostumeCel *cel = getDecodedCel(_costumeId, (const byte *)akhd, v1);
+	if (cel) {
+		codec1_decoded(v1, *cel);
+		return;
+	}
+
 	y = v1.y;
 	src = _srcptr;
 	dst = v1.destptr;
@@ -580,32 +587,8 @@ void AkosRenderer::codec1_genericDecode(Codec1 &v1) {
 				} else {
 					masked = (y < v1.boundsRect.top || y >= v1.boundsRect.bottom) || (v1.x < 0 || v1.x >= v1.boundsRect.right) || (*mask & maskbit);
 
-					if (color && !masked && !skip_column) {
-						pcolor = _palette[color];
-						if (_shadow_mode == 1) {
-							if (pcolor == 13)
-								pcolor = _shadow_table[*dst];
-						} else if (_shadow_mode == 2) {
-							error("codec1_spec2"); // TODO
-						} else if (_shadow_mode == 3) {
-							if (_vm->_game.features & GF_16BIT_COLOR) {
-								uint16 srcColor = (pcolor >> 1) & 0x7DEF;
-								uint16 dstColor = (READ_UINT16(dst) >> 1) & 0x7DEF;
-								pcolor = srcColor + dstColor;
-							} else if (_vm->_game.heversion >= 90) {
-								pcolor = (pcolor << 8) + *dst;
-								pcolor = xmap[pcolor];
-							} else if (pcolor < 8) {
-								pcolor = (pcolor << 8) + *dst;
-								pcolor = _shadow_table[pcolor];
-							}
-						}
-						if (_vm->_bytesPerPixel == 2) {
-							WRITE_UINT16(dst, pcolor);
-						} else {
-							*dst = pcolor;
-						}
-					}
+					if (color && !masked && !skip_column)
+						codec1_writePixel(dst, color);
 				}
 				dst += _out.pitch;
 				mask += _numStrips;
@@ -637,6 +620,93 @@ void AkosRenderer::codec1_genericDecode(Codec1 &v1) {
 	} while (1);
 }
 
+inline void AkosRenderer::codec1_writePixel(byte *dst, uint16 color) const {
+	uint16 pcolor = _palette[color];
+	if (_shadow_mode == 1) {
+		if (pcolor == 13)
+			pcolor = _shadow_table[*dst];
+	} else if (_shadow_mode == 2) {
+		error("codec1_spec2"); // TODO
+	} else if (_shadow_mode == 3) {
+		if (_vm->_game.features & GF_16BIT_COLOR) {
+			uint16 srcColor = (pcolor >> 1) & 0x7DEF;
+			uint16 dstColor = (READ_UINT16(dst) >> 1) & 0x7DEF;
+			pcolor = srcColor + dstColor;
+		} else if (_vm->_game.heversion >= 90) {
+			pcolor = (pcolor << 8) + *dst;
+			pcolor = xmap[pcolor];
+		} else if (pcolor < 8) {
+			pcolor = (pcolor << 8) + *dst;
+			pcolor = _shadow_table[pcolor];
+		}
+	}
+	if (_vm->_bytesPerPixel == 2) {
+		WRITE_UINT16(dst, pcolor);
+	} else {
+		*dst = pcolor;
+	}
+}
+
+// Same as codec1_genericDecode(), but reading the pixels from a decoded cel.
+// Without vertical scaling the transparent rows at the top and bottom of
+// each column are skipped at once.
+void AkosRenderer::codec1_decoded(Codec1 &v1, const DecodedCostumeCel &cel) {
+	int column = v1.skipColumns;
+	bool skip_column = false;
+
+	while (1) {
+		const byte *src = &cel.pixels[column * _height];
+		const byte *mask = _vm->getMaskBuffer(v1.x - (_vm->_virtscr[kMainVirtScreen].xstart & 7), v1.y, _zbuf);
+		const byte maskbit = revBitMask(v1.x & 7);
+		byte *dst = v1.destptr;
+		int y = v1.y;
+		int first = 0, end = _height;
+
+		if (_scaleY == 255) {
+			first = cel.firstRow[column];
+			end = cel.endRow[column];
+			dst += first * _out.pitch;
+			mask += first * _numStrips;
+			y += first;
+		}
+
+		const byte *scaleytab = &v1.scaletable[v1.scaleYindex];
+		for (int row = first; row < end; row++) {
+			if (_scaleY != 255 && *scaleytab++ >= _scaleY)
+				continue;
+
+			const byte color = src[row];
+			if (_actorHitMode) {
+				if (color && y == _actorHitY && v1.x == _actorHitX) {
+					_actorHitResult = true;
+					return;
+				}
+			} else if (color && !skip_column) {
+				const bool masked = (y < v1.boundsRect.top || y >= v1.boundsRect.bottom) || (v1.x < 0 || v1.x >= v1.boundsRect.right) || (*mask & maskbit);
+				if (!masked)
+					codec1_writePixel(dst, color);
+			}
+			dst += _out.pitch;
+			mask += _numStrips;
+			y++;
+		}
+
+		if (!--v1.skip_width)
+			return;
+		column++;
+
+		if (_scaleX == 255 || v1.scaletable[v1.scaleXindex] < _scaleX) {
+			v1.x += v1.scaleXstep;
+			if (v1.x < 0 || v1.x >= v1.boundsRect.right)
+				return;
+			v1.destptr += v1.scaleXstep * _vm->_bytesPerPixel;
+			skip_column = false;
+		} else
+			skip_column = true;
+		v1.scaleXindex += v1.scaleXstep;
+	}
+}
+
 // This is exact duplicate of smallCostumeScaleTable[] in costume.cpp
 // See FIXME below for explanation
 const byte smallCostumeScaleTableAKOS[256] = {
@@ -811,6 +881,9 @@ byte AkosRenderer::codec1(int xmoveCur, int ymoveCur) {
 		v1.shr = 4;
 	}
 
+	v1.celptr = _srcptr;
+	v1.skipColumns = 0;
+
 	use_scaling = (_scaleX != 0xFF) || (_scaleY != 0xFF);
 
 	v1.x = _actorX;
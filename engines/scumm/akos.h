@@ -73,6 +73,8 @@ protected:
 	const byte *rgbs;		// HE specific: RGB table
 	const uint8 *xmap;		// HE specific: shadow color table
 
+	int _costumeId;
+
 	struct {
 		bool repeatMode;
 		int repeatCount;
@@ -97,6 +99,7 @@ public:
 		akct = 0;
 		rgbs = 0;
 		xmap = 0;
+		_costumeId = 0;
 		_actorHitMode = false;
 	}
 
@@ -113,6 +116,8 @@ protected:
 
 	byte codec1(int xmoveCur, int ymoveCur);
 	void codec1_genericDecode(Codec1 &v1);
+	void codec1_decoded(Codec1 &v1, const DecodedCostumeCel &cel);
+	inline void codec1_writePixel(byte *dst, uint16 color) const;
 	byte codec5(int xmoveCur, int ymoveCur);
 	byte codec16(int xmoveCur, int ymoveCur);
 	byte codec32(int xmoveCur, int ymoveCur);
@@ -58,7 +58,13 @@ byte BaseCostumeRenderer::drawCostume(const VirtScreen &vs, int numStrips, const
 	return result;
 }
 
+BaseCostumeRenderer::~BaseCostumeRenderer() {
+	for (DecodedCelMap::iterator it = _decodedCels.begin(); it != _decodedCels.end(); ++it)
+		delete it->_value;
+}
+
 void BaseCostumeRenderer::codec1_ignorePakCols(Codec1 &v1, int num) {
+	v1.skipColumns = num;
 	num *= _height;
 
 	do {
@@ -76,6 +82,84 @@ void BaseCostumeRenderer::codec1_ignorePakCols(Codec1 &v1, int num) {
 	} while (1);
 }
 
+const DecodedCostumeCel *BaseCostumeRenderer::getDecodedCel(int costume, const byte *costumePtr, const Codec1 &v1) {
+	DecodedCelMap::iterator it = _decodedCels.find(v1.celptr);
+	if (it != _decodedCels.end()) {
+		DecodedCostumeCel *cel = it->_value;
+		if (cel->costume == costume && cel->costumePtr == costumePtr && cel->width == _width && cel->height == _height) {
+			cel->lastUsed = ++_decodedCelsCounter;
+			return cel;
+		}
+
+		// The memory now holds another costume, or this one was reloaded
+		_decodedCelsSize -= cel->getMemorySize();
+		delete cel;
+		_decodedCels.erase(it);
+	}
+
+	if (_width <= 0 || _height <= 0 || _width * _height > kDecodedCelsSize / 8)
+		return NULL;
+
+	DecodedCostumeCel *cel = new DecodedCostumeCel();
+	cel->costume = costume;
+	cel->costumePtr = costumePtr;
+	cel->width = _width;
+	cel->height = _height;
+	cel->lastUsed = ++_decodedCelsCounter;
+	decodeCel(*cel, v1.celptr, v1);
+
+	_decodedCels[v1.celptr] = cel;
+	_decodedCelsSize += cel->getMemorySize();
+	trimDecodedCels();
+	return cel;
+}
+
+void BaseCostumeRenderer::decodeCel(DecodedCostumeCel &cel, const byte *src, const Codec1 &v1) {
+	const uint32 size = cel.width * cel.height;
+	cel.pixels.resize(size);
+
+	uint32 pos = 0;
+	while (pos < size) {
+		byte len = *src++;
+		const byte color = len >> v1.shr;
+		len &= v1.mask;
+		if (!len)
+			len = *src++;
+
+		// A length of 0 repeats the color 256 times, like in the decoders
+		const uint32 count = MIN<uint32>(len ? len : 256, size - pos);
+		memset(&cel.pixels[pos], color, count);
+		pos += count;
+	}
+
+	cel.firstRow.resize(cel.width);
+	cel.endRow.resize(cel.width);
+	for (int x = 0; x < cel.width; x++) {
+		const byte *column = &cel.pixels[x * cel.height];
+		int first = 0, end = cel.height;
+		while (first < end && !column[first])
+			first++;
+		while (end > first && !column[end - 1])
+			end--;
+		cel.firstRow[x] = first;
+		cel.endRow[x] = end;
+	}
+}
+
+void BaseCostumeRenderer::trimDecodedCels() {
+	while (_decodedCelsSize > kDecodedCelsSize && !_decodedCels.empty()) {
+		DecodedCelMap::iterator oldest = _decodedCels.begin();
+		for (DecodedCelMap::iterator it = _decodedCels.begin(); it != _decodedCels.end(); ++it) {
+			if (it->_value->lastUsed < oldest->_value->lastUsed)
+				oldest = it;
+		}
+
+		_decodedCelsSize -= oldest->_value->getMemorySize();
+		delete oldest->_value;
+		_decodedCels.erase(oldest);
+	}
+}
+
 bool ScummEngine::isCostumeInUse(int cost) const {
 	int i;
 	Actor *a;
@@ -24,6 +24,9 @@
 #define SCUMM_BASE_COSTUME_H
 
 #include "common/scummsys.h"
+#include "common/array.h"
+#include "common/hash-ptr.h"
+#include "common/hashmap.h"
 #include "scumm/actor.h"		// for CostumeData
 
 namespace Scumm {
@@ -63,6 +66,27 @@ public:
 };
 
 
+/**
+ * A costume cel decoded from the run length encoding shared by the classic
+ * costumes and AKOS codec 1. The color indices are stored column by column
+ * like in the encoded data, before palette, shadow and scaling are applied,
+ * so the same cel serves every actor using it.
+ */
+struct DecodedCostumeCel {
+	int costume;
+	const byte *costumePtr;
+	int width, height;
+	uint32 lastUsed;
+
+	Common::Array<byte> pixels;
+	/** For every column, the first row and one past the last row which are not transparent */
+	Common::Array<uint16> firstRow, endRow;
+
+	uint32 getMemorySize() const {
+		return pixels.size() + (firstRow.size() + endRow.size()) * sizeof(uint16);
+	}
+};
+
 /**
  * Base class for both ClassicCostumeRenderer and AkosRenderer.
  */
@@ -122,6 +146,10 @@ public:
 		// These ones aren't accessed from ARM code.
 		Common::Rect boundsRect;
 		int scaleXindex, scaleYindex;
+		// Start of the encoded cel, and the number of columns of it
+		// skipped by codec1_ignorePakCols()
+		const byte *celptr;
+		int skipColumns;
 	};
 
 	BaseCostumeRenderer(ScummEngine *scumm) {
@@ -141,8 +169,11 @@ public:
 		_width = _height = 0;
 		_skipLimbs = 0;
 		_paletteNum = 0;
+
+		_decodedCelsSize = 0;
+		_decodedCelsCounter = 0;
 	}
-	virtual ~BaseCostumeRenderer() {}
+	virtual ~BaseCostumeRenderer();
 
 	virtual void setPalette(uint16 *palette) = 0;
 	virtual void setFacing(const Actor *a) = 0;
@@ -155,6 +186,27 @@ protected:
 	virtual byte drawLimb(const Actor *a, int limb) = 0;
 
 	void codec1_ignorePakCols(Codec1 &v1, int num);
+
+	/**
+	 * Get the cel of _width x _height pixels at v1.celptr decoded, from the
+	 * cache if possible. Returns NULL if the cel is too large to be cached.
+	 */
+	const DecodedCostumeCel *getDecodedCel(int costume, const byte *costumePtr, const Codec1 &v1);
+
+private:
+	typedef Common::HashMap<const byte *, DecodedCostumeCel *> DecodedCelMap;
+
+	enum {
+		/** Memory used for decoded cels */
+		kDecodedCelsSize = 1024 * 1024
+	};
+
+	void decodeCel(DecodedCostumeCel &cel, const byte *src, const Codec1 &v1);
+	void trimDecodedCels();
+
+	DecodedCelMap _decodedCels;
+	uint32 _decodedCelsSize;
+	uint32 _decodedCelsCounter;
 };
 
 } // End of namespace Scumm
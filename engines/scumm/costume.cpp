@@ -112,6 +112,9 @@ byte ClassicCostumeRenderer::mainRoutine(int xmoveCur, int ymoveCur) {
 		break;
 	}
 
+	v1.celptr = _srcptr;
+	v1.skipColumns = 0;
+
 	use_scaling = (_scaleX != 0xFF) || (_scaleY != 0xFF);
 
 	v1.x = _actorX;
@@ -438,7 +441,7 @@ void ClassicCostumeRenderer::proc3(Codec1 &v1) {
 	byte *dst;
 	byte len, maskbit;
 	int y;
-	uint color, height, pcolor;
+	uint color, height;
 	byte scaleIndexY;
 	bool masked;
 
@@ -462,6 +465,12 @@ void ClassicCostumeRenderer::proc3(Codec1 &v1) {
 	}
 #endif /* USE_ARM_COSTUME_ASM */
 
+	const DecodedCostumeCel *cel = getDecodedCel(_loaded._id, _loaded._baseptr, v1);
+	if (cel) {
+		proc3_decoded(v1, *cel);
+		return;
+	}
+
 	y = v1.y;
 	src = _srcptr;
 	dst = v1.destptr;
@@ -487,16 +496,8 @@ void ClassicCostumeRenderer::proc3(Codec1 &v1) {
 			if (_scaleY == 255 || v1.scaletable[scaleIndexY++] < _scaleY) {
 				masked = (y < 0 || y >= _out.h) || (v1.x < 0 || v1.x >= _out.w) || (v1.mask_ptr && (mask[0] & maskbit));
 
-				if (color && !masked) {
-					if (_shadow_mode & 0x20) {
-						pcolor = _shadow_table[*dst];
-					} else {
-						pcolor = _palette[color];
-						if (pcolor == 13 && _shadow_table)
-							pcolor = _shadow_table[*dst];
-					}
-					*dst = pcolor;
-				}
+				if (color && !masked)
+					proc3_writePixel(dst, color);
 				dst += _out.pitch;
 				mask += _numStrips;
 				y++;
@@ -525,6 +526,75 @@ void ClassicCostumeRenderer::proc3(Codec1 &v1) {
 	} while (1);
 }
 
+inline void ClassicCostumeRenderer::proc3_writePixel(byte *dst, uint color) const {
+	uint pcolor;
+	if (_shadow_mode & 0x20) {
+		pcolor = _shadow_table[*dst];
+	} else {
+		pcolor = _palette[color];
+		if (pcolor == 13 && _shadow_table)
+			pcolor = _shadow_table[*dst];
+	}
+	*dst = pcolor;
+}
+
+// Same as proc3(), but reading the pixels from a decoded cel. Without
+// vertical scaling the transparent rows at the top and bottom of each
+// column are skipped at once.
+void ClassicCostumeRenderer::proc3_decoded(Codec1 &v1, const DecodedCostumeCel &cel) {
+	int column = v1.skipColumns;
+
+	while (1) {
+		const byte *src = &cel.pixels[column * _height];
+		const byte *mask = v1.mask_ptr + v1.x / 8;
+		const byte maskbit = revBitMask(v1.x & 7);
+		const bool columnVisible = (v1.x >= 0 && v1.x < _out.w);
+		byte *dst = v1.destptr;
+		int y = v1.y;
+
+		if (_scaleY == 255) {
+			const int first = cel.firstRow[column];
+			const int end = cel.endRow[column];
+			dst += first * _out.pitch;
+			mask += first * _numStrips;
+			y += first;
+
+			for (int row = first; row < end; row++) {
+				const bool masked = (y < 0 || y >= _out.h) || !columnVisible || (v1.mask_ptr && (mask[0] & maskbit));
+				if (src[row] && !masked)
+					proc3_writePixel(dst, src[row]);
+				dst += _out.pitch;
+				mask += _numStrips;
+				y++;
+			}
+		} else {
+			byte scaleIndexY = _scaleIndexY;
+			for (int row = 0; row < _height; row++) {
+				if (v1.scaletable[scaleIndexY++] < _scaleY) {
+					const bool masked = (y < 0 || y >= _out.h) || !columnVisible || (v1.mask_ptr && (mask[0] & maskbit));
+					if (src[row] && !masked)
+						proc3_writePixel(dst, src[row]);
+					dst += _out.pitch;
+					mask += _numStrips;
+					y++;
+				}
+			}
+		}
+
+		if (!--v1.skip_width)
+			return;
+		column++;
+
+		if (_scaleX == 255 || v1.scaletable[_scaleIndexX] < _scaleX) {
+			v1.x += v1.scaleXstep;
+			if (v1.x < 0 || v1.x >= _out.w)
+				return;
+			v1.destptr += v1.scaleXstep;
+		}
+		_scaleIndexX += v1.scaleXstep;
+	}
+}
+
 void ClassicCostumeRenderer::proc3_ami(Codec1 &v1) {
 	const byte *mask, *src;
 	byte *dst;
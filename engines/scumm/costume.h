@@ -99,6 +99,8 @@ protected:
 	byte drawLimb(const Actor *a, int limb) override;
 
 	void proc3(Codec1 &v1);
+	void proc3_decoded(Codec1 &v1, const DecodedCostumeCel &cel);
+	inline void proc3_writePixel(byte *dst, uint color) const;
 	void proc3_ami(Codec1 &v1);
 
 	void procC64(Codec1 &v1, int actor);
@@ -215,6 +215,8 @@ Gdi::Gdi(ScummEngine *vm) : _vm(vm) {
 	_zbufferDisabled = false;
 	_objectMode = false;
 	_distaff = false;
+	_useStripCache = false;
+	resetStripCache();
 }
 
 Gdi::~Gdi() {
@@ -275,6 +277,7 @@ void Gdi::init() {
 }
 
 void Gdi::roomChanged(byte *roomptr) {
+	resetStripCache();
 }
 
 void GdiNES::roomChanged(byte *roomptr) {
@@ -1008,7 +1011,7 @@ void ScummEngine::redrawBGStrip(int start, int num) {
 	else
 		room = getResourceAddress(rtRoom, _roomResource);
 
-	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, 0);
+	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, Gdi::dbCacheStrips);
 }
 
 void ScummEngine::restoreBackground(Common::Rect rect, byte backColor) {
@@ -1800,6 +1803,10 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 	_objectMode = (flag & dbObjectMode) == dbObjectMode;
 	prepareDrawBitmap(ptr, vs, x, y, width, height, stripnr, numstrip);
 
+	_useStripCache = false;
+	if (flag & dbCacheStrips)
+		prepareStripCache(vs, smap_ptr, y, height);
+
 	sx = x - vs->xstart / 8;
 	if (sx < 0) {
 		numstrip -= -sx;
@@ -1913,7 +1920,64 @@ bool Gdi::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width,
 			_roomPalette = _vm->_roomPalette;
 	}
 
-	return decompressBitmap(dstPtr, vs->pitch, smap_ptr + offset, height);
+	if (!_useStripCache)
+		return decompressBitmap(dstPtr, vs->pitch, smap_ptr + offset, height);
+
+	const uint stripSize = 8 * height;
+	if ((uint)stripnr >= _stripCache.valid.size()) {
+		_stripCache.valid.resize(stripnr + 1);
+		_stripCache.pixels.resize((stripnr + 1) * stripSize);
+	}
+
+	byte *cachePtr = &_stripCache.pixels[stripnr * stripSize];
+	if (_stripCache.valid[stripnr]) {
+		for (int h = 0; h < height; ++h, dstPtr += vs->pitch, cachePtr += 8)
+			memcpy(dstPtr, cachePtr, 8);
+		return false;
+	}
+
+	const bool transpStrip = decompressBitmap(dstPtr, vs->pitch, smap_ptr + offset, height);
+	if (!transpStrip) {
+		for (int h = 0; h < height; ++h, dstPtr += vs->pitch, cachePtr += 8)
+			memcpy(cachePtr, dstPtr, 8);
+		_stripCache.valid[stripnr] = true;
+	}
+	return transpStrip;
+}
+
+void Gdi::prepareStripCache(const VirtScreen *vs, const byte *smap_ptr, int y, int height) {
+	// Only plain 8 bit room strips are cached. Indy4 Amiga switches palettes
+	// while drawing, HE games have their own ways to draw strips.
+	if (vs->format.bytesPerPixel != 1 || _objectMode || _vm->_game.heversion > 0 ||
+		(_vm->_game.platform == Common::kPlatformAmiga && _vm->_game.id == GID_INDY4))
+		return;
+
+	// Decoding maps the colors through the room palette, which scripts can change
+	uint32 paletteHash = 2166136261u;
+	for (int i = 0; i < 256; ++i)
+		paletteHash = (paletteHash ^ _roomPalette[i]) * 16777619u;
+
+	if (_stripCache.smapPtr != smap_ptr || _stripCache.room != _vm->_currentRoom ||
+		_stripCache.y != y || _stripCache.height != height || _stripCache.paletteHash != paletteHash) {
+		resetStripCache();
+		_stripCache.smapPtr = smap_ptr;
+		_stripCache.room = _vm->_currentRoom;
+		_stripCache.y = y;
+		_stripCache.height = height;
+		_stripCache.paletteHash = paletteHash;
+	}
+
+	_useStripCache = true;
+}
+
+void Gdi::resetStripCache() {
+	_stripCache.smapPtr = nullptr;
+	_stripCache.room = -1;
+	_stripCache.y = 0;
+	_stripCache.height = 0;
+	_stripCache.paletteHash = 0;
+	_stripCache.pixels.clear();
+	_stripCache.valid.clear();
 }
 
 bool GdiNES::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width, const int height,
@@ -209,6 +209,30 @@ protected:
 	/** Flag which is true when an object is being rendered, false otherwise. */
 	bool _objectMode;
 
+	/**
+	 * Decoded pixels of room background strips, so redrawing the background,
+	 * e.g. while scrolling, does not decode the same strips over and over.
+	 * Only opaque strips are cached, since the result of drawing transparent
+	 * ones depends on what is already in the buffer. The cache is only valid
+	 * for one bitmap, position and room palette.
+	 */
+	struct StripCache {
+		const byte *smapPtr;
+		int room;
+		int y;
+		int height;
+		uint32 paletteHash;
+		/** 8 pixels per line and height lines for every strip */
+		Common::Array<byte> pixels;
+		Common::Array<bool> valid;
+	};
+
+	StripCache _stripCache;
+	/** Flag which is true when the current bitmap is drawn through _stripCache. */
+	bool _useStripCache;
+
+	void prepareStripCache(const VirtScreen *vs, const byte *smap_ptr, int y, int height);
+
 public:
 	/** Flag which is true when loading objects or titles for distaff, in PCEngine version of Loom. */
 	bool _distaff;
@@ -279,10 +303,14 @@ public:
 
 	void resetBackground(int top, int bottom, int strip);
 
+	/** Discard all cached background strips. */
+	void resetStripCache();
+
 	enum DrawBitmapFlags {
 		dbAllowMaskOr   = 1 << 0,
 		dbDrawMaskOnAll = 1 << 1,
-		dbObjectMode    = 2 << 2
+		dbObjectMode    = 2 << 2,
+		dbCacheStrips   = 1 << 4
 	};
 };
 
@@ -0,0 +1,127 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifdef ENABLE_HE
+
+#include "scumm/he/hitgrid_he.h"
+
+namespace Scumm {
+
+void HitGrid::clear() {
+	_cells.clear();
+	_everywhere.clear();
+}
+
+int HitGrid::getCell(int coord) {
+	// Round towards negative infinity, items may be partially off screen
+	return (coord >= 0) ? coord / kCellSize : -((-coord - 1) / kCellSize) - 1;
+}
+
+uint32 HitGrid::getCellKey(int cellX, int cellY) {
+	return ((uint32)(cellX & 0xFFFF) << 16) | (uint32)(cellY & 0xFFFF);
+}
+
+bool HitGrid::isOversized(const Common::Rect &bound) {
+	const int cellsX = getCell(bound.right) - getCell(bound.left) + 1;
+	const int cellsY = getCell(bound.bottom) - getCell(bound.top) + 1;
+	return cellsX > kMaxItemCells || cellsY > kMaxItemCells || cellsX * cellsY > kMaxItemCells;
+}
+
+void HitGrid::insertIndex(IndexList &list, int index) {
+	uint pos = list.size();
+	while (pos > 0 && list[pos - 1] > index)
+		--pos;
+	list.insert_at(pos, index);
+}
+
+void HitGrid::removeIndex(IndexList &list, int index) {
+	for (uint i = 0; i < list.size(); ++i) {
+		if (list[i] == index) {
+			list.remove_at(i);
+			return;
+		}
+	}
+}
+
+void HitGrid::add(int index, const Common::Rect &bound) {
+	if (bound.left > bound.right || bound.top > bound.bottom)
+		return;
+
+	if (isOversized(bound)) {
+		insertIndex(_everywhere, index);
+		return;
+	}
+
+	for (int cellY = getCell(bound.top); cellY <= getCell(bound.bottom); ++cellY) {
+		for (int cellX = getCell(bound.left); cellX <= getCell(bound.right); ++cellX)
+			insertIndex(_cells[getCellKey(cellX, cellY)], index);
+	}
+}
+
+void HitGrid::addEverywhere(int index) {
+	insertIndex(_everywhere, index);
+}
+
+void HitGrid::remove(int index, const Common::Rect &bound) {
+	if (bound.left > bound.right || bound.top > bound.bottom)
+		return;
+
+	if (isOversized(bound)) {
+		removeIndex(_everywhere, index);
+		return;
+	}
+
+	for (int cellY = getCell(bound.top); cellY <= getCell(bound.bottom); ++cellY) {
+		for (int cellX = getCell(bound.left); cellX <= getCell(bound.right); ++cellX) {
+			CellMap::iterator cell = _cells.find(getCellKey(cellX, cellY));
+			if (cell == _cells.end())
+				continue;
+			removeIndex(cell->_value, index);
+			if (cell->_value.empty())
+				_cells.erase(cell);
+		}
+	}
+}
+
+void HitGrid::getCandidates(int x, int y, Common::Array<uint16> &candidates) const {
+	candidates.clear();
+
+	CellMap::const_iterator cell = _cells.find(getCellKey(getCell(x), getCell(y)));
+	if (cell == _cells.end()) {
+		candidates = _everywhere;
+		return;
+	}
+
+	// Merge both sorted lists
+	const IndexList &list = cell->_value;
+	uint i = 0, j = 0;
+	while (i < list.size() || j < _everywhere.size()) {
+		if (j == _everywhere.size() || (i < list.size() && list[i] < _everywhere[j]))
+			candidates.push_back(list[i++]);
+		else
+			candidates.push_back(_everywhere[j++]);
+	}
+}
+
+} // End of namespace Scumm
+
+#endif // ENABLE_HE
@@ -0,0 +1,78 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#if !defined(SCUMM_HE_HITGRID_HE_H) && defined(ENABLE_HE)
+#define SCUMM_HE_HITGRID_HE_H
+
+#include "common/array.h"
+#include "common/hashmap.h"
+#include "common/rect.h"
+
+namespace Scumm {
+
+/**
+ * A uniform grid over the bounding boxes of polygons or sprites, used to
+ * find the few items which may contain a point without testing all of
+ * them. Items are identified by their index in the owner's table. The
+ * candidates are returned in ascending index order, so callers keep the
+ * precedence of a linear scan over the table.
+ *
+ * The grid is conservative: callers still have to do the exact test on
+ * every candidate.
+ */
+class HitGrid {
+public:
+	enum {
+		kCellSize = 64,
+		/** Items covering more cells than this are checked at every point */
+		kMaxItemCells = 64
+	};
+
+	void clear();
+
+	/** Add an item covering the given rect, with right and bottom included. */
+	void add(int index, const Common::Rect &bound);
+	/** Add an item which is a candidate at every point. */
+	void addEverywhere(int index);
+	/** Remove an item, bound must be the one it was added with. */
+	void remove(int index, const Common::Rect &bound);
+
+	/** Get the items which may contain the point, in ascending order. */
+	void getCandidates(int x, int y, Common::Array<uint16> &candidates) const;
+
+private:
+	typedef Common::Array<uint16> IndexList;
+	typedef Common::HashMap<uint32, IndexList> CellMap;
+
+	static int getCell(int coord);
+	static uint32 getCellKey(int cellX, int cellY);
+	static bool isOversized(const Common::Rect &bound);
+	static void insertIndex(IndexList &list, int index);
+	static void removeIndex(IndexList &list, int index);
+
+	CellMap _cells;
+	IndexList _everywhere;
+};
+
+} // End of namespace Scumm
+
+#endif
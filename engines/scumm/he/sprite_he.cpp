@@ -41,7 +41,8 @@ Sprite::Sprite(ScummEngine_v90he *vm)
 	_numSpritesToProcess(0),
 	_varNumSpriteGroups(0),
 	_varNumSprites(0),
-	_varMaxSprites(0) {
+	_varMaxSprites(0),
+	_hitGridValid(false) {
 }
 
 Sprite::~Sprite() {
@@ -110,8 +111,11 @@ int Sprite::findSpriteWithClassOf(int x_pos, int y_pos, int spriteGroupId, int t
 	bool cond;
 	int code, classId;
 
-	for (int i = (_numSpritesToProcess - 1); i >= 0; i--) {
-		SpriteInfo *spi = _activeSpritesTable[i];
+	updateHitGrid();
+	_hitGrid.getCandidates(x_pos, y_pos, _hitCandidates);
+
+	for (int c = (int)_hitCandidates.size() - 1; c >= 0; c--) {
+		SpriteInfo *spi = _activeSpritesTable[_hitCandidates[c]];
 		if (!spi->curImage)
 			continue;
 
@@ -211,6 +215,23 @@ int Sprite::findSpriteWithClassOf(int x_pos, int y_pos, int spriteGroupId, int t
 	return 0;
 }
 
+void Sprite::updateHitGrid() {
+	if (_hitGridValid)
+		return;
+
+	_hitGrid.clear();
+	for (int i = 0; i < _numSpritesToProcess; i++) {
+		const SpriteInfo *spi = _activeSpritesTable[i];
+		// Hits on masked sprites are tested against the mask image, which
+		// is not bound by the sprite's bounding box
+		if (spi->maskImage)
+			_hitGrid.addEverywhere(i);
+		else
+			_hitGrid.add(i, spi->bbox);
+	}
+	_hitGridValid = true;
+}
+
 int Sprite::getSpriteClass(int spriteId, int num, int *args) {
 	assertRange(1, spriteId, _varNumSprites, "sprite");
 	int code, classId;
@@ -521,6 +542,7 @@ void Sprite::setSpriteMaskImage(int spriteId, int value) {
 	assertRange(1, spriteId, _varNumSprites, "sprite");
 
 	_spriteTable[spriteId].maskImage = value;
+	_hitGridValid = false;
 }
 
 void Sprite::setSpriteImageState(int spriteId, int state) {
@@ -1062,6 +1084,7 @@ void Sprite::allocTables(int numSprites, int numGroups, int numMaxSprites) {
 	_numSpritesToProcess = 0;
 	_varNumSprites = numSprites;
 	_varMaxSprites = numMaxSprites;
+	_hitGridValid = false;
 	_spriteGroups = (SpriteGroup *)malloc((_varNumSpriteGroups + 1) * sizeof(SpriteGroup));
 	_spriteTable = (SpriteInfo *)malloc((_varNumSprites + 1) * sizeof(SpriteInfo));
 	_activeSpritesTable = (SpriteInfo **)malloc((_varNumSprites + 1) * sizeof(SpriteInfo *));
@@ -1100,6 +1123,7 @@ void Sprite::resetTables(bool refreshScreen) {
 		_vm->restoreBackgroundHE(Common::Rect(_vm->_screenWidth, _vm->_screenHeight));
 	}
 	_numSpritesToProcess = 0;
+	_hitGridValid = false;
 }
 
 void Sprite::resetBackground() {
@@ -1220,6 +1244,7 @@ void Sprite::sortActiveSprites() {
 	int groupZorder;
 
 	_numSpritesToProcess = 0;
+	_hitGridValid = false;
 
 	if (_varNumSprites <= 1)
 		return;
@@ -1260,6 +1285,9 @@ void Sprite::processImages(bool arg) {
 	int32 w, h;
 	WizParameters wiz;
 
+	// The bounding boxes of the sprites are updated below
+	_hitGridValid = false;
+
 	for (int i = 0; i < _numSpritesToProcess; i++) {
 		SpriteInfo *spi = _activeSpritesTable[i];
 
@@ -1464,8 +1492,10 @@ void Sprite::saveLoadWithSerializer(Common::Serializer &s) {
 	}
 
 	// Reset active sprite table
-	if (s.isLoading())
+	if (s.isLoading()) {
 		_numSpritesToProcess = 0;
+		_hitGridValid = false;
+	}
 }
 
 } // End of namespace Scumm
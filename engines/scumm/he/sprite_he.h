@@ -24,6 +24,7 @@
 #define SCUMM_HE_SPRITE_HE_H
 
 #include "common/serializer.h"
+#include "scumm/he/hitgrid_he.h"
 
 namespace Scumm {
 
@@ -265,7 +266,18 @@ public:
 	void resetTables(bool refreshScreen);
 	void setSpriteImage(int spriteId, int imageNum);
 private:
+	void updateHitGrid();
+
 	ScummEngine_v90he *_vm;
+
+	/**
+	 * Index of the active sprites by bounding box, for findSpriteWithClassOf().
+	 * It is rebuilt on the next query whenever the active sprites, their
+	 * bounding boxes or their mask images change.
+	 */
+	HitGrid _hitGrid;
+	bool _hitGridValid;
+	Common::Array<uint16> _hitCandidates;
 };
 
 } // End of namespace Scumm
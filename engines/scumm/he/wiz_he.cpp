@@ -23,6 +23,7 @@
 #ifdef ENABLE_HE
 
 #include "common/archive.h"
+#include "common/config-manager.h"
 #include "common/system.h"
 #include "graphics/cursorman.h"
 #include "graphics/primitives.h"
@@ -41,6 +42,14 @@ Wiz::Wiz(ScummEngine_v71he *vm) : _vm(vm) {
 	memset(&_polygons, 0, sizeof(_polygons));
 	_cursorImage = false;
 	_rectOverrideEnabled = false;
+
+	_decodedImagesSize = 0;
+	_decodedImagesLimit = CLIP(ConfMan.getInt("he_wiz_cache"), 0, 65536) * 1024;
+	_decodedImagesCounter = 0;
+}
+
+Wiz::~Wiz() {
+	clearDecodedWizImages();
 }
 
 void Wiz::clearWizBuffer() {
@@ -49,11 +58,40 @@ void Wiz::clearWizBuffer() {
 
 void Wiz::polygonClear() {
 	for (int i = 0; i < ARRAYSIZE(_polygons); i++) {
-		if (_polygons[i].flag == 1)
+		if (_polygons[i].flag == 1) {
+			polygonIndexRemove(i);
 			_polygons[i].reset();
+		}
 	}
 }
 
+void Wiz::polygonIndexAdd(int slot) {
+	const WizPolygon &wp = _polygons[slot];
+	if (!wp.numVerts)
+		return;
+
+	_polygonGrid.add(slot, wp.bound);
+	++_polygonIdCount[wp.id];
+}
+
+void Wiz::polygonIndexRemove(int slot) {
+	const WizPolygon &wp = _polygons[slot];
+	if (!wp.numVerts)
+		return;
+
+	_polygonGrid.remove(slot, wp.bound);
+	Common::HashMap<int, uint>::iterator count = _polygonIdCount.find(wp.id);
+	if (count != _polygonIdCount.end() && --count->_value == 0)
+		_polygonIdCount.erase(count);
+}
+
+void Wiz::polygonRebuildIndex() {
+	_polygonGrid.clear();
+	_polygonIdCount.clear();
+	for (int i = 0; i < ARRAYSIZE(_polygons); i++)
+		polygonIndexAdd(i);
+}
+
 void Wiz::polygonLoad(const uint8 *polData) {
 	int slots = READ_LE_UINT32(polData);
 	polData += 4;
@@ -106,6 +144,7 @@ void Wiz::polygonStore(int id, bool flag, int vert1x, int vert1y, int vert2x, in
 	wp->flag = flag;
 
 	polygonCalcBoundBox(wp->vert, wp->numVerts, wp->bound);
+	polygonIndexAdd(wp - _polygons);
 }
 
 void Wiz::polygonRotatePoints(Common::Point *pts, int num, int angle) {
@@ -172,16 +211,22 @@ void Wiz::polygonCalcBoundBox(Common::Point *vert, int numVerts, Common::Rect &b
 
 void Wiz::polygonErase(int fromId, int toId) {
 	for (int i = 0; i < ARRAYSIZE(_polygons); i++) {
-		if (_polygons[i].id >= fromId && _polygons[i].id <= toId)
+		if (_polygons[i].id >= fromId && _polygons[i].id <= toId) {
+			polygonIndexRemove(i);
 			_polygons[i].reset();
+		}
 	}
 }
 
 int Wiz::polygonHit(int id, int x, int y) {
-	for (int i = 0; i < ARRAYSIZE(_polygons); i++) {
-		if ((id == 0 || _polygons[i].id == id) && _polygons[i].bound.contains(x, y)) {
-			if (polygonContains(_polygons[i], x, y)) {
-				return _polygons[i].id;
+	// Only the polygons whose bounds may contain the point are tested, in
+	// slot order like a scan over all of them
+	_polygonGrid.getCandidates(x, y, _polygonCandidates);
+	for (uint i = 0; i < _polygonCandidates.size(); i++) {
+		const WizPolygon &wp = _polygons[_polygonCandidates[i]];
+		if ((id == 0 || wp.id == id) && wp.bound.contains(x, y)) {
+			if (polygonContains(wp, x, y)) {
+				return wp.id;
 			}
 		}
 	}
@@ -189,10 +234,14 @@ int Wiz::polygonHit(int id, int x, int y) {
 }
 
 bool Wiz::polygonDefined(int id) {
-	for (int i = 0; i < ARRAYSIZE(_polygons); i++)
-		if (_polygons[i].id == id)
-			return true;
-	return false;
+	// Free slots have id 0
+	if (id == 0) {
+		for (int i = 0; i < ARRAYSIZE(_polygons); i++)
+			if (_polygons[i].id == id)
+				return true;
+		return false;
+	}
+	return _polygonIdCount.contains(id);
 }
 
 bool Wiz::polygonContains(const WizPolygon &pol, int x, int y) {
@@ -907,9 +956,14 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dstPtr += dstInc;
+					if (type == kWizCopy && dstInc == 1) {
+						memset(dstPtr, *dataPtr, code);
+						dstPtr += code;
+					} else {
+						while (code--) {
+							write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
+							dstPtr += dstInc;
+						}
 					}
 					dataPtr++;
 				} else {
@@ -927,10 +981,16 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dataPtr++;
-						dstPtr += dstInc;
+					if (type == kWizCopy && dstInc == 1) {
+						memcpy(dstPtr, dataPtr, code);
+						dataPtr += code;
+						dstPtr += code;
+					} else {
+						while (code--) {
+							write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
+							dataPtr++;
+							dstPtr += dstInc;
+						}
 					}
 				}
 			}
@@ -940,6 +1000,189 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 	}
 }
 
+void Wiz::decodeWizImage(DecodedWizImage &image, const uint8 *src) {
+	image.pixels.resize(image.width * image.height);
+	image.spans.clear();
+	image.rowSpans.resize(image.height + 1);
+
+	uint8 *dst = image.pixels.begin();
+	for (int y = 0; y < image.height; y++) {
+		const uint32 firstSpan = image.spans.size();
+		image.rowSpans[y] = firstSpan;
+
+		const uint16 lineSize = READ_LE_UINT16(src); src += 2;
+		const uint8 *srcNext = src + lineSize;
+		int x = 0;
+		while (x < image.width && src < srcNext) {
+			const uint8 code = *src++;
+			if (code & 1) {
+				x += code >> 1;
+				continue;
+			}
+
+			const int count = MIN((code >> 2) + 1, image.width - x);
+			if (code & 2) {
+				memset(dst + x, *src++, count);
+			} else {
+				memcpy(dst + x, src, count);
+				src += (code >> 2) + 1;
+			}
+
+			// Runs which are not separated by a skip form a single span
+			if (image.spans.size() > firstSpan && image.spans.back() == x) {
+				image.spans.back() = x + count;
+			} else {
+				image.spans.push_back(x);
+				image.spans.push_back(x + count);
+			}
+			x += count;
+		}
+		src = srcNext;
+		dst += image.width;
+	}
+	image.rowSpans[image.height] = image.spans.size();
+}
+
+template<int type>
+void Wiz::copyDecodedWizImage(uint8 *dst, int dstPitch, int dstType, const DecodedWizImage &image, const Common::Rect &srcRect, int flags, const uint8 *palPtr, const uint8 *xmapPtr, uint8 bitDepth) {
+	const int w = srcRect.width();
+	const int h = srcRect.height();
+	if (h <= 0 || w <= 0)
+		return;
+
+	if (flags & kWIFFlipY) {
+		dst += (h - 1) * dstPitch;
+		dstPitch = -dstPitch;
+	}
+	int dstInc = bitDepth;
+	if (flags & kWIFFlipX) {
+		dst += (w - 1) * bitDepth;
+		dstInc = -bitDepth;
+	}
+
+	for (int y = srcRect.top; y < srcRect.bottom; y++) {
+		const uint8 *srcRow = image.pixels.begin() + y * image.width;
+		for (uint32 i = image.rowSpans[y]; i < image.rowSpans[y + 1]; i += 2) {
+			if (image.spans[i] >= srcRect.right)
+				break;
+			const int x0 = MAX<int>(image.spans[i], srcRect.left);
+			const int x1 = MIN<int>(image.spans[i + 1], srcRect.right);
+			if (x0 >= x1)
+				continue;
+
+			uint8 *dstPtr = dst + (x0 - srcRect.left) * dstInc;
+			if (type == kWizCopy && dstInc == 1) {
+				memcpy(dstPtr, srcRow + x0, x1 - x0);
+			} else {
+				for (int x = x0; x < x1; x++) {
+					write8BitColor<type>(dstPtr, srcRow + x, dstType, palPtr, xmapPtr, bitDepth);
+					dstPtr += dstInc;
+				}
+			}
+		}
+		dst += dstPitch;
+	}
+}
+
+DecodedWizImage *Wiz::getDecodedWizImage(int resNum, int state, const uint8 *wizd, int width, int height) {
+	const uint32 key = (resNum << 16) | (state & 0xFFFF);
+	DecodedWizImageMap::iterator it = _decodedImages.find(key);
+	if (it != _decodedImages.end()) {
+		DecodedWizImage *image = it->_value;
+		if (image->wizd == wizd && image->width == width && image->height == height) {
+			image->lastUsed = ++_decodedImagesCounter;
+			return image;
+		}
+
+		// The resource has been reloaded since it was decoded
+		_decodedImagesSize -= image->getMemorySize();
+		delete image;
+		_decodedImages.erase(it);
+	}
+
+	// Don't let a single image push everything else out of the cache
+	if (width <= 0 || height <= 0 || (uint32)(width * height) > _decodedImagesLimit / 2)
+		return NULL;
+
+	DecodedWizImage *image = new DecodedWizImage();
+	image->wizd = wizd;
+	image->width = width;
+	image->height = height;
+	image->lastUsed = ++_decodedImagesCounter;
+	decodeWizImage(*image, wizd);
+
+	_decodedImages[key] = image;
+	_decodedImagesSize += image->getMemorySize();
+	trimDecodedWizImages(_decodedImagesLimit);
+	return image;
+}
+
+void Wiz::trimDecodedWizImages(uint32 limit) {
+	while (_decodedImagesSize > limit && !_decodedImages.empty()) {
+		DecodedWizImageMap::iterator oldest = _decodedImages.begin();
+		for (DecodedWizImageMap::iterator it = _decodedImages.begin(); it != _decodedImages.end(); ++it) {
+			if (it->_value->lastUsed < oldest->_value->lastUsed)
+				oldest = it;
+		}
+
+		_decodedImagesSize -= oldest->_value->getMemorySize();
+		delete oldest->_value;
+		_decodedImages.erase(oldest);
+	}
+}
+
+void Wiz::clearDecodedWizImages() {
+	for (DecodedWizImageMap::iterator it = _decodedImages.begin(); it != _decodedImages.end(); ++it)
+		delete it->_value;
+	_decodedImages.clear();
+	_decodedImagesSize = 0;
+}
+
+bool Wiz::drawDecodedWizImage(uint8 *dst, int resNum, int state, uint8 *dataPtr, int dstPitch, int dstType, int dstw, int dsth, int srcx, int srcy, const Common::Rect *rect, int flags, const uint8 *palPtr, const uint8 *xmapPtr) {
+	if (!_decodedImagesLimit || (flags & (kWIFZPlaneOn | kWIFZPlaneOff)))
+		return false;
+
+	// Images which were created or changed at runtime are decoded from
+	// their current data on every draw
+	if (_vm->_res->isModified(rtImage, resNum))
+		return false;
+
+	uint8 *wizh = _vm->findWrappedBlock(MKTAG('W','I','Z','H'), dataPtr, state, 0);
+	assert(wizh);
+	if (READ_LE_UINT32(wizh + 0x0) != 1)
+		return false;
+	const int width  = READ_LE_UINT32(wizh + 0x4);
+	const int height = READ_LE_UINT32(wizh + 0x8);
+
+	uint8 *wizd = _vm->findWrappedBlock(MKTAG('W','I','Z','D'), dataPtr, state, 0);
+	assert(wizd);
+	const DecodedWizImage *image = getDecodedWizImage(resNum, state, wizd, width, height);
+	if (!image)
+		return false;
+
+	const uint8 bitDepth = _vm->_bytesPerPixel;
+	Common::Rect r1, r2;
+	if (calcClipRects(dstw, dsth, srcx, srcy, width, height, rect, r1, r2)) {
+		dst += r2.top * dstPitch + r2.left * bitDepth;
+		if (flags & kWIFFlipY) {
+			const int dy = (srcy < 0) ? srcy : (height - r1.height());
+			r1.translate(0, dy);
+		}
+		if (flags & kWIFFlipX) {
+			const int dx = (srcx < 0) ? srcx : (width - r1.width());
+			r1.translate(dx, 0);
+		}
+		if (xmapPtr) {
+			copyDecodedWizImage<kWizXMap>(dst, dstPitch, dstType, *image, r1, flags, palPtr, xmapPtr, bitDepth);
+		} else if (palPtr) {
+			copyDecodedWizImage<kWizRMap>(dst, dstPitch, dstType, *image, r1, flags, palPtr, NULL, bitDepth);
+		} else {
+			copyDecodedWizImage<kWizCopy>(dst, dstPitch, dstType, *image, r1, flags, NULL, NULL, bitDepth);
+		}
+	}
+	return true;
+}
+
 // NOTE: These templates are used outside this file. We don't want the compiler to optimize them away, so we need to explicitely instantiate them.
 template void Wiz::decompressWizImage<kWizXMap>(uint8 *dst, int dstPitch, int dstType, const uint8 *src, const Common::Rect &srcRect, int flags, const uint8 *palPtr, const uint8 *xmapPtr, uint8 bitDepth);
 template void Wiz::decompressWizImage<kWizRMap>(uint8 *dst, int dstPitch, int dstType, const uint8 *src, const Common::Rect &srcRect, int flags, const uint8 *palPtr, const uint8 *xmapPtr, uint8 bitDepth);
@@ -1581,7 +1824,7 @@ uint8 *Wiz::drawWizImage(int resNum, int state, int maskNum, int maskState, int
 		y1 = 0;
 		width = rScreen.width();
 		height = rScreen.height();
-	} else {
+	} else if (mask || !drawDecodedWizImage(dst, resNum, state, dataPtr, dstPitch, dstType, cw, ch, x1, y1, &rScreen, flags, palPtr, xmapPtr)) {
 		drawWizImageEx(dst, dataPtr, mask, dstPitch, dstType, cw, ch, x1, y1, width, height,
 			state, &rScreen, flags, palPtr, transColor, _vm->_bytesPerPixel, xmapPtr, conditionBits);
 	}
@@ -23,7 +23,10 @@
 #if !defined(SCUMM_HE_WIZ_HE_H) && defined(ENABLE_HE)
 #define SCUMM_HE_WIZ_HE_H
 
+#include "common/array.h"
+#include "common/hashmap.h"
 #include "common/rect.h"
+#include "scumm/he/hitgrid_he.h"
 
 namespace Scumm {
 
@@ -231,6 +234,27 @@ enum DstSurface {
  	kDstCursor   = 3
 };
 
+/**
+ * An RLE compressed Wiz image state decoded to plain 8-bit pixels, as kept
+ * by the decoded image cache. The transparent parts are described by the
+ * opaque spans of every row, so drawing it only touches opaque pixels.
+ */
+struct DecodedWizImage {
+	const uint8 *wizd;
+	int width, height;
+	uint32 lastUsed;
+
+	Common::Array<uint8> pixels;
+	/** Start and end column of the opaque spans of all rows */
+	Common::Array<uint16> spans;
+	/** Index of the first span of each row in spans, plus one for the end */
+	Common::Array<uint32> rowSpans;
+
+	uint32 getMemorySize() const {
+		return pixels.size() + spans.size() * sizeof(uint16) + rowSpans.size() * sizeof(uint32);
+	}
+};
+
 class ScummEngine_v71he;
 
 class Wiz {
@@ -245,6 +269,7 @@ public:
 	WizPolygon _polygons[NUM_POLYGONS];
 
 	Wiz(ScummEngine_v71he *vm);
+	~Wiz();
 
 	void clearWizBuffer();
 	Common::Rect _rectOverride;
@@ -261,6 +286,8 @@ public:
 	bool polygonContains(const WizPolygon &pol, int x, int y);
 	void polygonRotatePoints(Common::Point *pts, int num, int alpha);
 	void polygonTransform(int resNum, int state, int po_x, int po_y, int angle, int zoom, Common::Point *vert);
+	/** Rebuild the hit test index after _polygons was changed directly. */
+	void polygonRebuildIndex();
 
 	void createWizEmptyImage(int resNum, int x1, int y1, int width, int height);
 	void fillWizRect(const WizParameters *params);
@@ -319,6 +346,7 @@ public:
 	template<int type> static void decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const uint8 *src, const Common::Rect &srcRect, int flags, const uint8 *xmapPtr = NULL);
 #endif
 	template<int type> static void decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8 *src, const Common::Rect &srcRect, int flags, const uint8 *palPtr, const uint8 *xmapPtr, uint8 bitdepth);
+	template<int type> static void copyDecodedWizImage(uint8 *dst, int dstPitch, int dstType, const DecodedWizImage &image, const Common::Rect &srcRect, int flags, const uint8 *palPtr, const uint8 *xmapPtr, uint8 bitDepth);
 	template<int type> static void decompressRawWizImage(uint8 *dst, int dstPitch, int dstType, const uint8 *src, int srcPitch, int w, int h, int transColor, const uint8 *palPtr, uint8 bitdepth);
 
 #ifdef USE_RGB_COLOR
@@ -332,8 +360,31 @@ public:
 	void computeWizHistogram(uint32 *histogram, const uint8 *data, const Common::Rect& rCapt);
 	void computeRawWizHistogram(uint32 *histogram, const uint8 *data, int srcPitch, const Common::Rect& rCapt);
 
+	/** Drop all images from the decoded image cache. */
+	void clearDecodedWizImages();
+
 private:
+	typedef Common::HashMap<uint32, DecodedWizImage *> DecodedWizImageMap;
+
+	bool drawDecodedWizImage(uint8 *dst, int resNum, int state, uint8 *dataPtr, int dstPitch, int dstType, int dstw, int dsth, int srcx, int srcy, const Common::Rect *rect, int flags, const uint8 *palPtr, const uint8 *xmapPtr);
+	DecodedWizImage *getDecodedWizImage(int resNum, int state, const uint8 *wizd, int width, int height);
+	static void decodeWizImage(DecodedWizImage &image, const uint8 *src);
+	void trimDecodedWizImages(uint32 limit);
+
+	void polygonIndexAdd(int slot);
+	void polygonIndexRemove(int slot);
+
 	ScummEngine_v71he *_vm;
+
+	DecodedWizImageMap _decodedImages;
+	uint32 _decodedImagesSize;
+	uint32 _decodedImagesLimit;
+	uint32 _decodedImagesCounter;
+
+	HitGrid _polygonGrid;
+	/** Number of stored polygons for each id */
+	Common::HashMap<int, uint> _polygonIdCount;
+	Common::Array<uint16> _polygonCandidates;
 };
 
 } // End of namespace Scumm
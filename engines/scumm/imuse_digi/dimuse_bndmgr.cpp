@@ -22,6 +22,7 @@
 
 
 #include "common/scummsys.h"
+#include "common/config-manager.h"
 #include "scumm/scumm.h"
 #include "scumm/util.h"
 #include "scumm/file.h"
@@ -38,6 +39,23 @@ BundleDirCache::BundleDirCache() {
 		_budleDirCache[fileId].isCompressed = false;
 		_budleDirCache[fileId].indexTable = NULL;
 	}
+
+	_blockUseCounter = 0;
+	_blockData = NULL;
+	const int numBlocks = CLIP(ConfMan.getInt("dimuse_cache"), 0, 256);
+	if (numBlocks) {
+		_blockData = (byte *)malloc(numBlocks * kBlockSize);
+		assert(_blockData);
+		_blocks.resize(numBlocks);
+		for (int i = 0; i < numBlocks; i++) {
+			_blocks[i].slot = -1;
+			_blocks[i].index = -1;
+			_blocks[i].block = -1;
+			_blocks[i].size = 0;
+			_blocks[i].lastUsed = 0;
+			_blocks[i].data = _blockData + i * kBlockSize;
+		}
+	}
 }
 
 BundleDirCache::~BundleDirCache() {
@@ -45,6 +63,39 @@ BundleDirCache::~BundleDirCache() {
 		free(_budleDirCache[fileId].bundleTable);
 		free(_budleDirCache[fileId].indexTable);
 	}
+	free(_blockData);
+}
+
+int32 BundleDirCache::getBlock(int slot, int32 index, int32 block, byte *output) {
+	for (uint i = 0; i < _blocks.size(); i++) {
+		CachedBlock &cached = _blocks[i];
+		if (cached.block == block && cached.index == index && cached.slot == slot) {
+			cached.lastUsed = ++_blockUseCounter;
+			memcpy(output, cached.data, cached.size);
+			return cached.size;
+		}
+	}
+	return -1;
+}
+
+void BundleDirCache::addBlock(int slot, int32 index, int32 block, const byte *data, int32 size) {
+	if (_blocks.empty())
+		return;
+
+	assert(size <= kBlockSize);
+	uint victim = 0;
+	for (uint i = 1; i < _blocks.size(); i++) {
+		if (_blocks[i].lastUsed < _blocks[victim].lastUsed)
+			victim = i;
+	}
+
+	CachedBlock &cached = _blocks[victim];
+	cached.slot = slot;
+	cached.index = index;
+	cached.block = block;
+	cached.size = size;
+	cached.lastUsed = ++_blockUseCounter;
+	memcpy(cached.data, data, size);
 }
 
 BundleDirCache::AudioTable *BundleDirCache::getTable(int slot) {
@@ -147,6 +198,7 @@ BundleMgr::BundleMgr(BundleDirCache *cache) {
 	_numCompItems = 0;
 	_curSampleId = -1;
 	_fileBundleId = -1;
+	_slot = -1;
 	_file = new ScummFile();
 	_compInputBuff = NULL;
 }
@@ -184,13 +236,13 @@ bool BundleMgr::open(const char *filename, bool &compressed, bool errorFlag) {
 		return false;
 	}
 
-	int slot = _cache->matchFile(filename);
-	assert(slot != -1);
-	compressed = _cache->isSndDataExtComp(slot);
-	_numFiles = _cache->getNumFiles(slot);
+	_slot = _cache->matchFile(filename);
+	assert(_slot != -1);
+	compressed = _cache->isSndDataExtComp(_slot);
+	_numFiles = _cache->getNumFiles(_slot);
 	assert(_numFiles);
-	_bundleTable = _cache->getTable(slot);
-	_indexTable = _cache->getIndexTable(slot);
+	_bundleTable = _cache->getTable(_slot);
+	_indexTable = _cache->getIndexTable(_slot);
 	assert(_bundleTable);
 	_compTableLoaded = false;
 	_outputSize = 0;
@@ -288,13 +340,17 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 
 	for (i = firstBlock; i <= lastBlock; i++) {
 		if (_lastBlock != i) {
-			// CMI hack: one more zero byte at the end of input buffer
-			_compInputBuff[_compTable[i].size] = 0;
-			_file->seek(_bundleTable[index].offset + _compTable[i].offset, SEEK_SET);
-			_file->read(_compInputBuff, _compTable[i].size);
-			_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
-			if (_outputSize > 0x2000) {
-				error("_outputSize: %d", _outputSize);
+			_outputSize = _cache->getBlock(_slot, index, i, _compOutputBuff);
+			if (_outputSize < 0) {
+				// CMI hack: one more zero byte at the end of input buffer
+				_compInputBuff[_compTable[i].size] = 0;
+				_file->seek(_bundleTable[index].offset + _compTable[i].offset, SEEK_SET);
+				_file->read(_compInputBuff, _compTable[i].size);
+				_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
+				if (_outputSize > 0x2000) {
+					error("_outputSize: %d", _outputSize);
+				}
+				_cache->addBlock(_slot, index, i, _compOutputBuff, _outputSize);
 			}
 			_lastBlock = i;
 		}
@@ -24,6 +24,7 @@
 #define SCUMM_IMUSE_DIGI_BUNDLE_MGR_H
 
 #include "common/scummsys.h"
+#include "common/array.h"
 #include "common/file.h"
 
 namespace Scumm {
@@ -53,7 +54,29 @@ private:
 		IndexNode *indexTable;
 	} _budleDirCache[4];
 
+	/**
+	 * A decompressed block of a sound in a bundle. The blocks are shared by
+	 * all BundleMgr instances, so they survive a sound being closed and
+	 * reopened, which happens a lot during music transitions.
+	 */
+	struct CachedBlock {
+		int slot;
+		int32 index;
+		int32 block;
+		int32 size;
+		uint32 lastUsed;
+		byte *data;
+	};
+
+	Common::Array<CachedBlock> _blocks;
+	byte *_blockData;
+	uint32 _blockUseCounter;
+
 public:
+	enum {
+		kBlockSize = 0x2000
+	};
+
 	BundleDirCache();
 	~BundleDirCache();
 
@@ -62,6 +85,17 @@ public:
 	IndexNode *getIndexTable(int slot);
 	int32 getNumFiles(int slot);
 	bool isSndDataExtComp(int slot);
+
+	/**
+	 * Copy a cached decompressed block to output, which must be able to hold
+	 * kBlockSize bytes.
+	 *
+	 * @return the size of the block, or -1 if it is not cached
+	 */
+	int32 getBlock(int slot, int32 index, int32 block, byte *output);
+
+	/** Add a decompressed block to the cache, replacing the least recently used one. */
+	void addBlock(int slot, int32 index, int32 block, const byte *data, int32 size);
 };
 
 class BundleMgr {
@@ -85,7 +119,8 @@ private:
 	BaseScummFile *_file;
 	bool _compTableLoaded;
 	int _fileBundleId;
-	byte _compOutputBuff[0x2000];
+	int _slot;
+	byte _compOutputBuff[BundleDirCache::kBlockSize];
 	byte *_compInputBuff;
 	int _outputSize;
 	int _lastBlock;
@@ -126,6 +126,7 @@ MODULE_OBJS += \
 	he/animation_he.o \
 	he/cup_player_he.o \
 	he/floodfill_he.o \
+	he/hitgrid_he.o \
 	he/logic_he.o \
 	he/palette_he.o \
 	he/script_v71he.o \
@@ -1620,6 +1620,12 @@ void ScummEngine_v71he::saveLoadWithSerializer(Common::Serializer &s) {
 	ScummEngine_v70he::saveLoadWithSerializer(s);
 
 	s.syncArray(_wiz->_polygons, ARRAYSIZE(_wiz->_polygons), syncWithSerializer);
+
+	if (s.isLoading()) {
+		_wiz->polygonRebuildIndex();
+		// Images restored from the savegame may reuse the memory of cached ones
+		_wiz->clearDecodedWizImages();
+	}
 }
 
 void syncWithSerializer(Common::Serializer &s, FloodFillParameters &ffp) {
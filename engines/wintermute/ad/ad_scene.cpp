@@ -90,6 +90,8 @@ void AdScene::setDefaults() {
 	_mainLayer = nullptr;
 
 	_pfPointsNum = 0;
+	_walkMap.clear();
+	_walkMapRegionState.clear();
 	_persistentState = false;
 	_persistentStateSprites = true;
 
@@ -334,43 +336,56 @@ uint32 AdScene::getAlphaAt(int x, int y, bool colorCheck) {
 
 //////////////////////////////////////////////////////////////////////////
 bool AdScene::isBlockedAt(int x, int y, bool checkFreeObjects, BaseObject *requester) {
-	bool ret = true;
+	if (checkFreeObjects && isBlockedByObjectAt(x, y, requester)) {
+		return true;
+	}
+	return getWalkabilityAt(x, y) != kWalkFree;
+}
 
-	if (checkFreeObjects) {
-		for (uint32 i = 0; i < _objects.size(); i++) {
-			if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
-				if (_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return true;
-				}
+
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::isWalkableAt(int x, int y, bool checkFreeObjects, BaseObject *requester) {
+	if (checkFreeObjects && isBlockedByObjectAt(x, y, requester)) {
+		return false;
+	}
+	return getWalkabilityAt(x, y) == kWalkFree;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::isBlockedByObjectAt(int x, int y, BaseObject *requester) {
+	for (uint32 i = 0; i < _objects.size(); i++) {
+		if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
+			if (_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
+				return true;
 			}
 		}
-		AdGame *adGame = (AdGame *)_gameRef;
-		for (uint32 i = 0; i < adGame->_objects.size(); i++) {
-			if (adGame->_objects[i]->_active && adGame->_objects[i] != requester && adGame->_objects[i]->_currentBlockRegion) {
-				if (adGame->_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return true;
-				}
+	}
+	AdGame *adGame = (AdGame *)_gameRef;
+	for (uint32 i = 0; i < adGame->_objects.size(); i++) {
+		if (adGame->_objects[i]->_active && adGame->_objects[i] != requester && adGame->_objects[i]->_currentBlockRegion) {
+			if (adGame->_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
+				return true;
 			}
 		}
 	}
+	return false;
+}
 
 
+//////////////////////////////////////////////////////////////////////////
+AdScene::Walkability AdScene::getWalkabilityAt(int x, int y) {
+	Walkability ret = kWalkNoRegion;
+
 	if (_mainLayer) {
 		for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
 			AdSceneNode *node = _mainLayer->_nodes[i];
-			/*
-			if (Node->_type == OBJECT_REGION && Node->_region->_active && Node->_region->_blocked && Node->_region->PointInRegion(X, Y))
-			{
-			    ret = true;
-			    break;
-			}
-			*/
 			if (node->_type == OBJECT_REGION && node->_region->_active && !node->_region->hasDecoration() && node->_region->pointInRegion(x, y)) {
 				if (node->_region->isBlocked()) {
-					ret = true;
+					ret = kWalkBlocked;
 					break;
 				} else {
-					ret = false;
+					ret = kWalkFree;
 				}
 			}
 		}
@@ -380,42 +395,65 @@ bool AdScene::isBlockedAt(int x, int y, bool checkFreeObjects, BaseObject *reque
 
 
 //////////////////////////////////////////////////////////////////////////
-bool AdScene::isWalkableAt(int x, int y, bool checkFreeObjects, BaseObject *requester) {
-	bool ret = false;
+AdScene::Walkability AdScene::getCachedWalkabilityAt(int x, int y) {
+	// validateWalkMap() must have been called in this frame
+	if (_walkMap.empty() || x < 0 || y < 0 || x >= _mainLayer->_width || y >= _mainLayer->_height) {
+		return getWalkabilityAt(x, y);
+	}
 
-	if (checkFreeObjects) {
-		for (uint32 i = 0; i < _objects.size(); i++) {
-			if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
-				if (_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return false;
-				}
-			}
+	byte &walkability = _walkMap[y * _mainLayer->_width + x];
+	if (walkability == kWalkUnknown) {
+		walkability = getWalkabilityAt(x, y);
+	}
+	return (Walkability)walkability;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::getRegionState(Common::Array<int32> &state) {
+	// Scripts can change the regions in many ways, so rather than tracking
+	// every change, record everything getWalkabilityAt() depends on
+	state.push_back(_mainLayer->_width);
+	state.push_back(_mainLayer->_height);
+	for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
+		AdSceneNode *node = _mainLayer->_nodes[i];
+		if (node->_type != OBJECT_REGION) {
+			continue;
 		}
-		AdGame *adGame = (AdGame *)_gameRef;
-		for (uint32 i = 0; i < adGame->_objects.size(); i++) {
-			if (adGame->_objects[i]->_active && adGame->_objects[i] != requester && adGame->_objects[i]->_currentBlockRegion) {
-				if (adGame->_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return false;
-				}
-			}
+
+		AdRegion *region = node->_region;
+		state.push_back(region->_active | (region->hasDecoration() << 1) | (region->isBlocked() << 2));
+		state.push_back(region->_rect.left);
+		state.push_back(region->_rect.top);
+		state.push_back(region->_rect.right);
+		state.push_back(region->_rect.bottom);
+		state.push_back(region->_points.size());
+		for (uint32 j = 0; j < region->_points.size(); j++) {
+			state.push_back(region->_points[j]->x);
+			state.push_back(region->_points[j]->y);
 		}
 	}
+}
 
 
-	if (_mainLayer) {
-		for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
-			AdSceneNode *node = _mainLayer->_nodes[i];
-			if (node->_type == OBJECT_REGION && node->_region->_active && !node->_region->hasDecoration() && node->_region->pointInRegion(x, y)) {
-				if (node->_region->isBlocked()) {
-					ret = false;
-					break;
-				} else {
-					ret = true;
-				}
-			}
-		}
+//////////////////////////////////////////////////////////////////////////
+void AdScene::validateWalkMap() {
+	if (!_mainLayer || _mainLayer->_width <= 0 || _mainLayer->_height <= 0) {
+		_walkMap.clear();
+		_walkMapRegionState.clear();
+		return;
 	}
-	return ret;
+
+	Common::Array<int32> state;
+	getRegionState(state);
+	const uint32 size = _mainLayer->_width * _mainLayer->_height;
+	if (state == _walkMapRegionState && _walkMap.size() == size) {
+		return;
+	}
+
+	_walkMapRegionState = state;
+	_walkMap.resize(size);
+	memset(&_walkMap[0], kWalkUnknown, size);
 }
 
 
@@ -443,7 +481,7 @@ int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject
 		y = y1;
 
 		for (xCount = x1; xCount < x2; xCount++) {
-			if (isBlockedAt(xCount, (int)y, true, requester)) {
+			if (isBlockedByObjectAt(xCount, (int)y, requester) || getCachedWalkabilityAt(xCount, (int)y) != kWalkFree) {
 				return -1;
 			}
 			y += yStep;
@@ -458,7 +496,7 @@ int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject
 		x = x1;
 
 		for (yCount = y1; yCount < y2; yCount++) {
-			if (isBlockedAt((int)x, yCount, true, requester)) {
+			if (isBlockedByObjectAt((int)x, yCount, requester) || getCachedWalkabilityAt((int)x, yCount) != kWalkFree) {
 				return -1;
 			}
 			x += xStep;
@@ -515,6 +553,12 @@ void AdScene::pathFinderStep() {
 
 //////////////////////////////////////////////////////////////////////////
 bool AdScene::initLoop() {
+	// Scripts do not run while searching, so the regions stay the same for
+	// all steps of this loop
+	if (!_pfReady) {
+		validateWalkMap();
+	}
+
 #ifdef _DEBUGxxxx
 	int nu_steps = 0;
 	uint32 start = _gameRef->_currentTime;
@@ -171,6 +171,26 @@ private:
 	BaseObject *_pfRequester;
 	BaseArray<AdPathPoint *> _pfPath;
 
+	enum Walkability {
+		kWalkUnknown = 0,
+		kWalkNoRegion,
+		kWalkBlocked,
+		kWalkFree
+	};
+
+	// The walkability of every pixel of the main layer, as far as the regions
+	// of the layer are concerned. It is filled in on demand while searching
+	// paths and discarded when the regions change, which is checked once per
+	// frame by comparing the state of the regions the map was made for.
+	Common::Array<byte> _walkMap;
+	Common::Array<int32> _walkMapRegionState;
+
+	Walkability getWalkabilityAt(int x, int y);
+	Walkability getCachedWalkabilityAt(int x, int y);
+	bool isBlockedByObjectAt(int x, int y, BaseObject *requester);
+	void getRegionState(Common::Array<int32> &state);
+	void validateWalkMap();
+
 	int32 _offsetTop;
 	int32 _offsetLeft;
 
@@ -35,6 +35,11 @@
 #include "engines/wintermute/platform_osystem.h"
 #include "common/str.h"
 
+// Memory which may be used by the pixels of unused surfaces
+#define UNUSED_SURFACES_SIZE (32 * 1024 * 1024)
+// Maximum number of unused surfaces, whatever their size
+#define UNUSED_SURFACES_COUNT 256
+
 namespace Wintermute {
 
 //IMPLEMENT_PERSISTENT(BaseSurfaceStorage, true);
@@ -54,12 +59,13 @@ BaseSurfaceStorage::~BaseSurfaceStorage() {
 //////////////////////////////////////////////////////////////////////////
 bool BaseSurfaceStorage::cleanup(bool warn) {
 	for (uint32 i = 0; i < _surfaces.size(); i++) {
-		if (warn) {
+		if (warn && _surfaces[i]->_referenceCount > 0) {
 			BaseEngine::LOG(0, "BaseSurfaceStorage warning: purging surface '%s', usage:%d", _surfaces[i]->getFileName(), _surfaces[i]->_referenceCount);
 		}
 		delete _surfaces[i];
 	}
 	_surfaces.clear();
+	_unusedSurfaces.clear();
 
 	return STATUS_OK;
 }
@@ -91,8 +97,8 @@ bool BaseSurfaceStorage::removeSurface(BaseSurface *surface) {
 		if (_surfaces[i] == surface) {
 			_surfaces[i]->_referenceCount--;
 			if (_surfaces[i]->_referenceCount <= 0) {
-				delete _surfaces[i];
-				_surfaces.remove_at(i);
+				_unusedSurfaces.push_back(_surfaces[i]);
+				trimUnusedSurfaces();
 			}
 			break;
 		}
@@ -101,10 +107,54 @@ bool BaseSurfaceStorage::removeSurface(BaseSurface *surface) {
 }
 
 
+//////////////////////////////////////////////////////////////////////
+void BaseSurfaceStorage::trimUnusedSurfaces() {
+	uint32 size = 0;
+	for (uint32 i = 0; i < _unusedSurfaces.size(); i++) {
+		size += _unusedSurfaces[i]->getMemorySize();
+	}
+
+	// Surfaces which were never decoded take no memory, so limit their number
+	// as well
+	while ((size > UNUSED_SURFACES_SIZE || _unusedSurfaces.size() > UNUSED_SURFACES_COUNT) && !_unusedSurfaces.empty()) {
+		BaseSurface *surface = _unusedSurfaces[0];
+		size -= surface->getMemorySize();
+		deleteSurface(surface);
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////
+void BaseSurfaceStorage::deleteSurface(BaseSurface *surface) {
+	for (uint32 i = 0; i < _unusedSurfaces.size(); i++) {
+		if (_unusedSurfaces[i] == surface) {
+			_unusedSurfaces.remove_at(i);
+			break;
+		}
+	}
+	for (uint32 i = 0; i < _surfaces.size(); i++) {
+		if (_surfaces[i] == surface) {
+			_surfaces.remove_at(i);
+			break;
+		}
+	}
+	delete surface;
+}
+
+
 //////////////////////////////////////////////////////////////////////
 BaseSurface *BaseSurfaceStorage::addSurface(const Common::String &filename, bool defaultCK, byte ckRed, byte ckGreen, byte ckBlue, int lifeTime, bool keepLoaded) {
 	for (uint32 i = 0; i < _surfaces.size(); i++) {
 		if (scumm_stricmp(_surfaces[i]->getFileName(), filename.c_str()) == 0) {
+			if (_surfaces[i]->_referenceCount <= 0) {
+				for (uint32 j = 0; j < _unusedSurfaces.size(); j++) {
+					if (_unusedSurfaces[j] == _surfaces[i]) {
+						_unusedSurfaces.remove_at(j);
+						break;
+					}
+				}
+				_surfaces[i]->_referenceCount = 0;
+			}
 			_surfaces[i]->_referenceCount++;
 			return _surfaces[i];
 		}
@@ -50,6 +50,17 @@ public:
 	~BaseSurfaceStorage() override;
 
 	Common::Array<BaseSurface *> _surfaces;
+
+private:
+	/**
+	 * Surfaces which are no longer referenced, least recently released
+	 * first. They are kept around, so switching back to a scene or
+	 * animation does not have to load and decode all its images again.
+	 */
+	Common::Array<BaseSurface *> _unusedSurfaces;
+
+	void trimUnusedSurfaces();
+	void deleteSurface(BaseSurface *surface);
 };
 
 } // End of namespace Wintermute
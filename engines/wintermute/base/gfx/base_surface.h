@@ -70,6 +70,10 @@ public:
 	virtual bool endPixelOp();
 	virtual bool isTransparentAtLite(int x, int y);
 	void setSize(int width, int height);
+	/** Get the number of bytes used by the pixels of the surface, without loading them. */
+	virtual uint32 getMemorySize() {
+		return _width * _height * 4;
+	}
 
 	int _referenceCount;
 
@@ -39,7 +39,12 @@
 #include "common/queue.h"
 #include "common/config-manager.h"
 
-#define DIRTY_RECT_LIMIT 800
+// Beyond this many dirty rects, they are merged into their bounding box
+#define DIRTY_RECT_LIMIT 32
+// Maximum number of unused tickets kept for reuse
+#define TICKET_POOL_SIZE 64
+// Maximum size in bytes of the surface copies held by the unused tickets
+#define TICKET_POOL_MAX_BYTES (4 * 1024 * 1024)
 
 namespace Wintermute {
 
@@ -52,12 +57,12 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 	_renderSurface = new Graphics::Surface();
 	_blankSurface = new Graphics::Surface();
 	_lastFrameIter = _renderQueue.end();
+	_ticketPoolBytes = 0;
 	_needsFlip = true;
 	_skipThisFrame = false;
 
 	_borderLeft = _borderRight = _borderTop = _borderBottom = 0;
 	_ratioX = _ratioY = 1.0f;
-	_dirtyRect = nullptr;
 	_disableDirtyRects = false;
 	if (ConfMan.hasKey("dirty_rects")) {
 		_disableDirtyRects = !ConfMan.getBool("dirty_rects");
@@ -75,7 +80,9 @@ BaseRenderOSystem::~BaseRenderOSystem() {
 		delete ticket;
 	}
 
-	delete _dirtyRect;
+	for (uint i = 0; i < _ticketPool.size(); i++) {
+		delete _ticketPool[i];
+	}
 
 	_renderSurface->free();
 	delete _renderSurface;
@@ -162,8 +169,7 @@ bool BaseRenderOSystem::forcedFlip() {
 bool BaseRenderOSystem::flip() {
 	if (_skipThisFrame) {
 		_skipThisFrame = false;
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		g_system->updateScreen();
 		_needsFlip = false;
 
@@ -186,7 +192,7 @@ bool BaseRenderOSystem::flip() {
 			if ((*it)->_wantsDraw == false) {
 				RenderTicket *ticket = *it;
 				it = _renderQueue.erase(it);
-				delete ticket;
+				releaseTicket(ticket);
 			} else {
 				(*it)->_wantsDraw = false;
 				++it;
@@ -203,8 +209,7 @@ bool BaseRenderOSystem::flip() {
 			g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
 		}
 		//  g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		_needsFlip = false;
 	}
 	_lastFrameIter = _renderQueue.end();
@@ -292,7 +297,7 @@ Graphics::PixelFormat BaseRenderOSystem::getPixelFormat() const {
 void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform) {
 
 	if (_disableDirtyRects) {
-		RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
+		RenderTicket *ticket = createTicket(owner, surf, srcRect, dstRect, transform);
 		ticket->_wantsDraw = true;
 		_renderQueue.push_back(ticket);
 		drawFromSurface(ticket);
@@ -324,7 +329,7 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 			}
 		}
 	}
-	RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
+	RenderTicket *ticket = createTicket(owner, surf, srcRect, dstRect, transform);
 	if (!_disableDirtyRects) {
 		drawFromTicket(ticket);
 	} else {
@@ -385,13 +390,65 @@ void BaseRenderOSystem::drawFromQueuedTicket(const RenderQueueIterator &ticket)
 	}
 }
 
-void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
-	if (!_dirtyRect) {
-		_dirtyRect = new Common::Rect(rect);
+uint32 BaseRenderOSystem::getTicketSurfaceSize(const RenderTicket *ticket) {
+	const Graphics::Surface *surface = ticket->getSurface();
+	return surface ? surface->pitch * surface->h : 0;
+}
+
+RenderTicket *BaseRenderOSystem::createTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform) {
+	if (_ticketPool.empty()) {
+		return new RenderTicket(owner, surf, srcRect, dstRect, transform);
+	}
+
+	RenderTicket *ticket = _ticketPool.back();
+	_ticketPool.pop_back();
+	_ticketPoolBytes -= getTicketSurfaceSize(ticket);
+	ticket->init(owner, surf, srcRect, dstRect, transform);
+	return ticket;
+}
+
+void BaseRenderOSystem::releaseTicket(RenderTicket *ticket) {
+	// Unused tickets keep their surface copy for the next ticket of the same
+	// size, so the pool is limited by the memory of these as well
+	const uint32 size = getTicketSurfaceSize(ticket);
+	if (_ticketPool.size() < TICKET_POOL_SIZE && _ticketPoolBytes + size <= TICKET_POOL_MAX_BYTES) {
+		_ticketPool.push_back(ticket);
+		_ticketPoolBytes += size;
 	} else {
-		_dirtyRect->extend(rect);
+		delete ticket;
 	}
-	_dirtyRect->clip(_renderRect);
+}
+
+void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
+	Common::Rect dirtyRect(rect);
+	dirtyRect.clip(_renderRect);
+	if (dirtyRect.isEmpty()) {
+		return;
+	}
+
+	// Keep the rects disjoint, so no pixel is drawn twice. Merging may make
+	// the rect overlap rects which were checked already, so start over then.
+	uint i = 0;
+	while (i < _dirtyRects.size()) {
+		if (_dirtyRects[i].contains(dirtyRect)) {
+			return;
+		}
+		if (_dirtyRects[i].intersects(dirtyRect)) {
+			dirtyRect.extend(_dirtyRects[i]);
+			_dirtyRects.remove_at(i);
+			i = 0;
+		} else {
+			++i;
+		}
+	}
+
+	if (_dirtyRects.size() >= DIRTY_RECT_LIMIT) {
+		for (i = 0; i < _dirtyRects.size(); i++) {
+			dirtyRect.extend(_dirtyRects[i]);
+		}
+		_dirtyRects.clear();
+	}
+	_dirtyRects.push_back(dirtyRect);
 }
 
 void BaseRenderOSystem::drawTickets() {
@@ -405,12 +462,12 @@ void BaseRenderOSystem::drawTickets() {
 			RenderTicket *ticket = *it;
 			addDirtyRect((*it)->_dstRect);
 			it = _renderQueue.erase(it);
-			delete ticket;
+			releaseTicket(ticket);
 		} else {
 			++it;
 		}
 	}
-	if (!_dirtyRect || _dirtyRect->width() == 0 || _dirtyRect->height() == 0) {
+	if (_dirtyRects.empty()) {
 		it = _renderQueue.begin();
 		while (it != _renderQueue.end()) {
 			RenderTicket *ticket = *it;
@@ -420,43 +477,66 @@ void BaseRenderOSystem::drawTickets() {
 		return;
 	}
 
-	it = _renderQueue.begin();
-	_lastFrameIter = _renderQueue.end();
-	// A special case: If the screen has one giant OPAQUE rect to be drawn, then we skip filling
-	// the background color. Typical use-case: Fullscreen FMVs.
+	// Find the topmost opaque ticket covering each dirty rect. Neither the
+	// clear color nor the tickets below it are visible there, which e.g. saves
+	// redrawing the background below fullscreen FMVs.
 	// Caveat: The FPS-counter will invalidate this.
-	if (it != _lastFrameIter && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
-		// If our single opaque rect fills the dirty rect, we can skip filling.
-		if (*_dirtyRect != (*it)->_dstRect) {
+	Common::Array<RenderTicket *> occluders(_dirtyRects.size(), nullptr);
+	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		RenderTicket *ticket = *it;
+		if (!ticket->isOpaque()) {
+			continue;
+		}
+		for (uint i = 0; i < _dirtyRects.size(); i++) {
+			if (ticket->_dstRect.contains(_dirtyRects[i])) {
+				occluders[i] = ticket;
+			}
+		}
+	}
+
+	for (uint i = 0; i < _dirtyRects.size(); i++) {
+		if (!occluders[i]) {
 			// Apply the clear-color to the dirty rect.
-			_renderSurface->fillRect(*_dirtyRect, _clearColor);
+			_renderSurface->fillRect(_dirtyRects[i], _clearColor);
 		}
-		// Otherwise Do NOT fill.
-	} else {
-		// Apply the clear-color to the dirty rect.
-		_renderSurface->fillRect(*_dirtyRect, _clearColor);
 	}
-	for (; it != _renderQueue.end(); ++it) {
+
+	_lastFrameIter = _renderQueue.end();
+	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
 		RenderTicket *ticket = *it;
-		if (ticket->_dstRect.intersects(*_dirtyRect)) {
-			// dstClip is the area we want redrawn.
-			Common::Rect dstClip(ticket->_dstRect);
-			// reduce it to the dirty rect
-			dstClip.clip(*_dirtyRect);
-			// we need to keep track of the position to redraw the dirty rect
-			Common::Rect pos(dstClip);
-			int16 offsetX = ticket->_dstRect.left;
-			int16 offsetY = ticket->_dstRect.top;
-			// convert from screen-coords to surface-coords.
-			dstClip.translate(-offsetX, -offsetY);
-
-			drawFromSurface(ticket, &pos, &dstClip);
-			_needsFlip = true;
+		for (uint i = 0; i < _dirtyRects.size(); i++) {
+			if (occluders[i]) {
+				// Skip everything below the occluding ticket
+				if (occluders[i] != ticket) {
+					continue;
+				}
+				occluders[i] = nullptr;
+			}
+
+			const Common::Rect &dirtyRect = _dirtyRects[i];
+			if (ticket->_dstRect.intersects(dirtyRect)) {
+				// dstClip is the area we want redrawn.
+				Common::Rect dstClip(ticket->_dstRect);
+				// reduce it to the dirty rect
+				dstClip.clip(dirtyRect);
+				// we need to keep track of the position to redraw the dirty rect
+				Common::Rect pos(dstClip);
+				int16 offsetX = ticket->_dstRect.left;
+				int16 offsetY = ticket->_dstRect.top;
+				// convert from screen-coords to surface-coords.
+				dstClip.translate(-offsetX, -offsetY);
+
+				drawFromSurface(ticket, &pos, &dstClip);
+				_needsFlip = true;
+			}
 		}
 		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
 		ticket->_wantsDraw = false;
 	}
-	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
+	for (uint i = 0; i < _dirtyRects.size(); i++) {
+		const Common::Rect &dirtyRect = _dirtyRects[i];
+		g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(dirtyRect.left, dirtyRect.top), _renderSurface->pitch, dirtyRect.left, dirtyRect.top, dirtyRect.width(), dirtyRect.height());
+	}
 
 	it = _renderQueue.begin();
 	// Clean out the old tickets
@@ -465,7 +545,7 @@ void BaseRenderOSystem::drawTickets() {
 			RenderTicket *ticket = *it;
 			addDirtyRect((*it)->_dstRect);
 			it = _renderQueue.erase(it);
-			delete ticket;
+			releaseTicket(ticket);
 		} else {
 			++it;
 		}
@@ -590,7 +670,7 @@ void BaseRenderOSystem::endSaveLoad() {
 	while (it != _renderQueue.end()) {
 		RenderTicket *ticket = *it;
 		it = _renderQueue.erase(it);
-		delete ticket;
+		releaseTicket(ticket);
 	}
 	// HACK: After a save the buffer will be drawn before the scripts get to update it,
 	// so just skip this single frame.
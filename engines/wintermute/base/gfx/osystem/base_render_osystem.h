@@ -32,6 +32,7 @@
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "common/rect.h"
 #include "graphics/surface.h"
+#include "common/array.h"
 #include "common/list.h"
 #include "graphics/transform_struct.h"
 
@@ -125,12 +126,26 @@ private:
 	 * Traverse the tickets that are dirty, and draw them
 	 */
 	void drawTickets();
+	/**
+	 * Get a ticket from the pool of unused tickets, or allocate a new one.
+	 */
+	RenderTicket *createTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform);
+	/**
+	 * Return a ticket which is no longer in the render queue to the pool.
+	 */
+	void releaseTicket(RenderTicket *ticket);
+	/** Get the memory used by the surface copy of a ticket. */
+	static uint32 getTicketSurfaceSize(const RenderTicket *ticket);
 	// Non-dirty-rects:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
-	Common::Rect *_dirtyRect;
+	/** The dirty parts of the screen, these never overlap */
+	Common::Array<Common::Rect> _dirtyRects;
 	Common::List<RenderTicket *> _renderQueue;
+	Common::Array<RenderTicket *> _ticketPool;
+	/** Total size of the surface copies of the tickets in _ticketPool */
+	uint32 _ticketPoolBytes;
 
 	bool _needsFlip;
 	RenderQueueIterator _lastFrameIter;
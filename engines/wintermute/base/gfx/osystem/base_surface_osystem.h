@@ -63,6 +63,9 @@ public:
 	/*  static unsigned DLL_CALLCONV ReadProc(void *buffer, unsigned size, unsigned count, fi_handle handle);
 	    static int DLL_CALLCONV SeekProc(fi_handle handle, long offset, int origin);
 	    static long DLL_CALLCONV TellProc(fi_handle handle);*/
+	uint32 getMemorySize() override {
+		return _surface ? _surface->pitch * _surface->h : 0;
+	}
 	int getWidth() override {
 		if (!_loaded) {
 			finishLoad();
@@ -36,15 +36,27 @@
 namespace Wintermute {
 
 RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct transform) :
-	_owner(owner),
-	_srcRect(*srcRect),
-	_dstRect(*dstRect),
-	_isValid(true),
-	_wantsDraw(true),
-	_transform(transform) {
+	_surface(nullptr) {
+	init(owner, surf, srcRect, dstRect, transform);
+}
+
+void RenderTicket::init(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct transform) {
+	_owner = owner;
+	_srcRect = *srcRect;
+	_dstRect = *dstRect;
+	_isValid = true;
+	_wantsDraw = true;
+	_transform = transform;
+
 	if (surf) {
-		_surface = new Graphics::Surface();
-		_surface->create((uint16)srcRect->width(), (uint16)srcRect->height(), surf->format);
+		if (!_surface || _surface->w != srcRect->width() || _surface->h != srcRect->height() || _surface->format != surf->format) {
+			if (_surface) {
+				_surface->free();
+			} else {
+				_surface = new Graphics::Surface();
+			}
+			_surface->create((uint16)srcRect->width(), (uint16)srcRect->height(), surf->format);
+		}
 		assert(_surface->format.bytesPerPixel == 4);
 		// Get a clipped copy of the surface
 		for (int i = 0; i < _surface->h; i++) {
@@ -83,7 +95,9 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 			delete _surface;
 			_surface = temp;
 		}
-	} else {
+	} else if (_surface) {
+		_surface->free();
+		delete _surface;
 		_surface = nullptr;
 	}
 }
@@ -95,6 +109,14 @@ RenderTicket::~RenderTicket() {
 	}
 }
 
+bool RenderTicket::isOpaque() const {
+	return _owner && _surface && _transform._alphaDisable &&
+		_transform._angle == Graphics::kDefaultAngle &&
+		_transform._numTimesX * _transform._numTimesY == 1 &&
+		_transform._rgbaMod == Graphics::kDefaultRgbaMod &&
+		_transform._blendMode == Graphics::BLEND_NORMAL;
+}
+
 bool RenderTicket::operator==(const RenderTicket &t) const {
 	if ((t._owner != _owner) ||
 		(t._transform != _transform)  ||
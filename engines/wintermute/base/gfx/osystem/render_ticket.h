@@ -52,8 +52,15 @@ class BaseSurfaceOSystem;
 class RenderTicket {
 public:
 	RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRest, Graphics::TransformStruct transform);
-	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()) {}
+	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()), _surface(nullptr) {}
 	~RenderTicket();
+	/**
+	 * Turn the ticket into a new one, as if it was just constructed with
+	 * these arguments. The surface copy is reused when it has the right size.
+	 */
+	void init(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct transform);
+	/** Check whether drawing the ticket replaces everything under its _dstRect. */
+	bool isOpaque() const;
 	const Graphics::Surface *getSurface() const { return _surface; }
 	// Non-dirty-rects:
 	void drawToSurface(Graphics::Surface *_targetSurface) const;
@@ -36,11 +36,15 @@
 #include "engines/wintermute/base/timer.h"
 #include "engines/wintermute/base/base_region.h"
 #include "engines/wintermute/base/base_file_manager.h"
+#include "engines/wintermute/base/base_sprite.h"
 #include "engines/wintermute/base/gfx/base_renderer.h"
+#include "engines/wintermute/system/sys_class_registry.h"
 #include "engines/wintermute/utils/utils.h"
 #include "common/str.h"
 #include "common/math.h"
 
+#define MAX_FREE_SPRITES 16
+
 namespace Wintermute {
 
 IMPLEMENT_PERSISTENT(PartEmitter, false)
@@ -111,10 +115,50 @@ PartEmitter::~PartEmitter(void) {
 	}
 	_sprites.clear();
 
+	for (uint32 i = 0; i < _freeSprites.size(); i++) {
+		delete _freeSprites[i];
+	}
+	_freeSprites.clear();
+
 	delete[] _emitEvent;
 	_emitEvent = nullptr;
 }
 
+//////////////////////////////////////////////////////////////////////////
+BaseSprite *PartEmitter::takeSprite(const Common::String &filename) {
+	for (uint32 i = 0; i < _freeSprites.size(); i++) {
+		BaseSprite *sprite = _freeSprites[i];
+		if (sprite->getFilename() && scumm_stricmp(filename.c_str(), sprite->getFilename()) == 0) {
+			_freeSprites.remove_at(i);
+			sprite->reset();
+			return sprite;
+		}
+	}
+
+	SystemClassRegistry::getInstance()->_disabled = true;
+	BaseSprite *sprite = new BaseSprite(_gameRef, (BaseObject *)_gameRef);
+	if (DID_FAIL(sprite->loadFile(filename))) {
+		delete sprite;
+		sprite = nullptr;
+	}
+	SystemClassRegistry::getInstance()->_disabled = false;
+	return sprite;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void PartEmitter::releaseSprite(BaseSprite *sprite) {
+	if (!sprite) {
+		return;
+	}
+
+	// Emitters with many sprites don't need a spare one for every particle
+	if (_freeSprites.size() >= MAX_FREE_SPRITES) {
+		delete _freeSprites[0];
+		_freeSprites.remove_at(0);
+	}
+	_freeSprites.add(sprite);
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool PartEmitter::addSprite(const char *filename) {
 	if (!filename) {
@@ -237,7 +281,7 @@ bool PartEmitter::initParticle(PartParticle *particle, uint32 currentTime, uint3
 	particle->_angVelocity = angVelocity;
 	particle->_growthRate = growthRate;
 	particle->_exponentialGrowth = _exponentialGrowth;
-	particle->_isDead = DID_FAIL(particle->setSprite(_sprites[spriteIndex]));
+	particle->_isDead = DID_FAIL(particle->setSprite(_sprites[spriteIndex], this));
 	particle->fadeIn(currentTime, _fadeInTime);
 
 
@@ -282,14 +326,17 @@ bool PartEmitter::updateInternal(uint32 currentTime, uint32 timerDelta) {
 			}
 
 			int toGen = MIN(_genAmount, _maxParticles - numLive);
+			// Particles before this index are known to be alive
+			uint32 searchStart = 0;
 			while (toGen > 0) {
 				int firstDeadIndex = -1;
-				for (uint32 i = 0; i < _particles.size(); i++) {
+				for (uint32 i = searchStart; i < _particles.size(); i++) {
 					if (_particles[i]->_isDead) {
 						firstDeadIndex = i;
 						break;
 					}
 				}
+				searchStart = firstDeadIndex >= 0 ? firstDeadIndex + 1 : _particles.size() + 1;
 
 				PartParticle *particle;
 				if (firstDeadIndex >= 0) {
@@ -326,6 +373,9 @@ bool PartEmitter::display(BaseRegion *region) {
 	}
 
 	for (uint32 i = 0; i < _particles.size(); i++) {
+		if (_particles[i]->_isDead) {
+			continue;
+		}
 		if (region != nullptr && _useRegion) {
 			if (!region->pointInRegion((int)_particles[i]->_pos.x, (int)_particles[i]->_pos.y)) {
 				continue;
@@ -368,8 +418,18 @@ bool PartEmitter::start() {
 
 //////////////////////////////////////////////////////////////////////////
 bool PartEmitter::sortParticlesByZ() {
-	// sort particles by _posY
-	Common::sort(_particles.begin(), _particles.end(), PartEmitter::compareZ);
+	// sort particles by _posZ
+	// Only the particles generated since the last sort are out of order, so
+	// an insertion sort only has to move a few of them
+	for (uint32 i = 1; i < _particles.size(); i++) {
+		PartParticle *particle = _particles[i];
+		uint32 j = i;
+		while (j > 0 && compareZ(particle, _particles[j - 1])) {
+			_particles[j] = _particles[j - 1];
+			j--;
+		}
+		_particles[j] = particle;
+	}
 	return STATUS_OK;
 }
 
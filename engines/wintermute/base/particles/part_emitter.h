@@ -35,6 +35,7 @@
 
 namespace Wintermute {
 class BaseRegion;
+class BaseSprite;
 class PartParticle;
 class PartEmitter : public BaseObject {
 public:
@@ -52,6 +53,13 @@ public:
 	bool display(BaseRegion *region);
 
 	bool sortParticlesByZ();
+	/**
+	 * Get a loaded sprite for a particle, reusing one given back by another
+	 * particle if possible. Returns nullptr if the sprite can't be loaded.
+	 */
+	BaseSprite *takeSprite(const Common::String &filename);
+	/** Keep a sprite which is no longer used by a particle for takeSprite(). */
+	void releaseSprite(BaseSprite *sprite);
 	bool addSprite(const char *filename);
 	bool removeSprite(const char *filename);
 	bool setBorder(int x, int y, int width, int height);
@@ -133,6 +141,8 @@ private:
 	uint32 _lastGenTime;
 	BaseArray<PartParticle *> _particles;
 	BaseArray<char *> _sprites;
+	// Sprites of dead particles, so new particles don't have to load them again
+	BaseArray<BaseSprite *> _freeSprites;
 };
 
 } // End of namespace Wintermute
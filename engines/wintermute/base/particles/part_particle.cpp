@@ -69,12 +69,18 @@ PartParticle::~PartParticle(void) {
 }
 
 //////////////////////////////////////////////////////////////////////////
-bool PartParticle::setSprite(const Common::String &filename) {
+bool PartParticle::setSprite(const Common::String &filename, PartEmitter *emitter) {
 	if (_sprite && _sprite->getFilename() && scumm_stricmp(filename.c_str(), _sprite->getFilename()) == 0) {
 		_sprite->reset();
 		return STATUS_OK;
 	}
 
+	if (emitter) {
+		emitter->releaseSprite(_sprite);
+		_sprite = emitter->takeSprite(filename);
+		return _sprite ? STATUS_OK : STATUS_FAILED;
+	}
+
 	delete _sprite;
 	_sprite = nullptr;
 
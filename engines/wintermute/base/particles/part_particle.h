@@ -72,7 +72,11 @@ public:
 	bool update(PartEmitter *emitter, uint32 currentTime, uint32 timerDelta);
 	bool display(PartEmitter *emitter);
 
-	bool setSprite(const Common::String &filename);
+	/**
+	 * Load the sprite of the particle. With an emitter, the sprite is taken
+	 * from the emitter's spare sprites and the old one is given back to it.
+	 */
+	bool setSprite(const Common::String &filename, PartEmitter *emitter = nullptr);
 
 	bool fadeIn(uint32 currentTime, int fadeTime);
 	bool fadeOut(uint32 currentTime, int fadeTime);
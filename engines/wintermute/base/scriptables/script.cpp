@@ -52,6 +52,9 @@ ScScript::ScScript(BaseGame *inGame, ScEngine *engine) : BaseClass(inGame) {
 	_symbols = nullptr;
 	_numSymbols = 0;
 
+	_decoded = false;
+	_nextDecodedInstruction = 0;
+
 	_engine = engine;
 
 	_globals = nullptr;
@@ -400,6 +403,12 @@ void ScScript::cleanup() {
 	_symbols = nullptr;
 	_numSymbols = 0;
 
+	_decodedInstructions.clear();
+	_variableCaches.clear();
+	_symbolAtoms.clear();
+	_decoded = false;
+	_nextDecodedInstruction = 0;
+
 	if (_globals && !_thread) {
 		delete _globals;
 	}
@@ -471,18 +480,22 @@ void ScScript::cleanup() {
 
 //////////////////////////////////////////////////////////////////////////
 uint32 ScScript::getDWORD() {
-	_scriptStream->seek((int32)_iP);
-	uint32 ret = _scriptStream->readUint32LE();
+	uint32 ret = 0;
+	if (_iP + sizeof(uint32) <= _bufferSize) {
+		ret = READ_LE_UINT32(_buffer + _iP);
+	}
 	_iP += sizeof(uint32);
-//	assert(oldRet == ret);
 	return ret;
 }
 
 //////////////////////////////////////////////////////////////////////////
 double ScScript::getFloat() {
-	_scriptStream->seek((int32)_iP);
 	byte buffer[8];
-	_scriptStream->read(buffer, 8);
+	if (_iP + 8 <= _bufferSize) {
+		memcpy(buffer, _buffer + _iP, 8);
+	} else {
+		memset(buffer, 0, 8);
+	}
 
 #ifdef SCUMM_BIG_ENDIAN
 	// TODO: For lack of a READ_LE_UINT64
@@ -506,17 +519,138 @@ char *ScScript::getString() {
 		_iP++;
 	}
 	_iP++; // string terminator
-	_scriptStream->seek(_iP);
 
 	return ret;
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+void ScScript::decodeInstruction(uint32 pos, DecodedInstruction &instruction) {
+	const uint32 origIP = _iP;
+
+	_iP = pos;
+	instruction.pos = pos;
+	instruction.inst = getDWORD();
+	instruction.cache = kNoVariableCache;
+	instruction.operand.dw = 0;
+
+	switch (instruction.inst) {
+	case II_PUSH_VAR:
+	case II_PUSH_VAR_REF:
+	case II_POP_VAR:
+	case II_PUSH_THIS:
+	case II_DEF_VAR:
+	case II_DEF_GLOB_VAR:
+	case II_DEF_CONST_VAR:
+	case II_CALL:
+	case II_EXTERNAL_CALL:
+	case II_CORRECT_STACK:
+	case II_PUSH_INT:
+	case II_PUSH_BOOL:
+	case II_JMP:
+	case II_JMP_FALSE:
+	case II_DBG_LINE:
+		instruction.operand.dw = getDWORD();
+		break;
+
+	case II_PUSH_FLOAT:
+		instruction.operand.f = getFloat();
+		break;
+
+	case II_PUSH_STRING:
+		instruction.operand.str = getString();
+		break;
+
+	default:
+		break;
+	}
+
+	instruction.next = _iP;
+	_iP = origIP;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void ScScript::decodeScript() {
+	_decoded = true;
+
+	_symbolAtoms.resize(_numSymbols);
+	for (uint32 i = 0; i < _numSymbols; i++) {
+		_symbolAtoms[i] = _engine->internAtom(_symbols[i]);
+	}
+
+	// The code block is followed by the tables
+	uint32 codeEnd = _bufferSize;
+	const uint32 tables[] = { _header.funcTable, _header.symbolTable, _header.eventTable, _header.methodTable,
+	                          _header.version >= 0x0101 ? _header.externalsTable : _bufferSize };
+	for (int i = 0; i < ARRAYSIZE(tables); i++) {
+		if (tables[i] > _header.codeStart && tables[i] < codeEnd) {
+			codeEnd = tables[i];
+		}
+	}
+
+	// Stop at anything which is not an instruction. Should the script ever
+	// get there, the instructions are decoded when they are run.
+	uint32 pos = _header.codeStart;
+	while (pos + sizeof(uint32) <= codeEnd) {
+		DecodedInstruction instruction;
+		decodeInstruction(pos, instruction);
+		if (instruction.inst > II_DEF_CONST_VAR || instruction.next > codeEnd) {
+			break;
+		}
+
+		// Give every variable access its own cache
+		switch (instruction.inst) {
+		case II_PUSH_VAR:
+		case II_PUSH_VAR_REF:
+		case II_POP_VAR:
+		case II_PUSH_THIS:
+			if (instruction.operand.dw < _numSymbols) {
+				VariableCache cache;
+				cache.scope = nullptr;
+				cache.var = nullptr;
+				cache.generation = 0;
+				instruction.cache = _variableCaches.size();
+				_variableCaches.push_back(cache);
+			}
+			break;
+		default:
+			break;
+		}
+
+		_decodedInstructions.push_back(instruction);
+		pos = instruction.next;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+const ScScript::DecodedInstruction *ScScript::findDecodedInstruction(uint32 pos) {
+	uint32 index = _nextDecodedInstruction;
+	if (index >= _decodedInstructions.size() || _decodedInstructions[index].pos != pos) {
+		// Not the following instruction, so the script jumped
+		uint32 first = 0;
+		uint32 last = _decodedInstructions.size();
+		while (first < last) {
+			const uint32 middle = (first + last) / 2;
+			if (_decodedInstructions[middle].pos < pos) {
+				first = middle + 1;
+			} else {
+				last = middle;
+			}
+		}
+		if (first >= _decodedInstructions.size() || _decodedInstructions[first].pos != pos) {
+			return nullptr;
+		}
+		index = first;
+	}
+
+	_nextDecodedInstruction = index + 1;
+	return &_decodedInstructions[index];
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool ScScript::executeInstruction() {
 	bool ret = STATUS_OK;
 
-	uint32 dw;
 	const char *str = nullptr;
 
 	//ScValue* op = new ScValue(_gameRef);
@@ -525,7 +659,19 @@ bool ScScript::executeInstruction() {
 	ScValue *op1;
 	ScValue *op2;
 
-	uint32 inst = getDWORD();
+	if (!_decoded) {
+		decodeScript();
+	}
+
+	DecodedInstruction undecoded;
+	const DecodedInstruction *instruction = findDecodedInstruction(_iP);
+	if (!instruction) {
+		decodeInstruction(_iP, undecoded);
+		instruction = &undecoded;
+	}
+	const uint32 dw = instruction->operand.dw;
+	const uint32 inst = instruction->inst;
+	_iP = instruction->next;
 
 	preInstHook(inst);
 
@@ -533,7 +679,6 @@ bool ScScript::executeInstruction() {
 
 	case II_DEF_VAR:
 		_operand->setNULL();
-		dw = getDWORD();
 		if (_scopeStack->_sP < 0) {
 			_globals->setProp(_symbols[dw], _operand);
 		} else {
@@ -544,7 +689,6 @@ bool ScScript::executeInstruction() {
 
 	case II_DEF_GLOB_VAR:
 	case II_DEF_CONST_VAR: {
-		dw = getDWORD();
 		/*      char *temp = _symbols[dw]; // TODO delete */
 		// only create global var if it doesn't exist
 		if (!_engine->_globals->propExists(_symbols[dw])) {
@@ -578,8 +722,6 @@ bool ScScript::executeInstruction() {
 
 
 	case II_CALL:
-		dw = getDWORD();
-
 		_operand->setInt(_iP);
 		_callStack->push(_operand);
 
@@ -674,7 +816,7 @@ bool ScScript::executeInstruction() {
 	break;
 
 	case II_EXTERNAL_CALL: {
-		uint32 symbolIndex = getDWORD();
+		uint32 symbolIndex = dw;
 
 		TExternalFunction *f = getExternal(_symbols[symbolIndex]);
 		if (f) {
@@ -691,8 +833,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_CORRECT_STACK:
-		dw = getDWORD(); // params expected
-		_stack->correctParams(dw);
+		_stack->correctParams(dw); // params expected
 		break;
 
 	case II_CREATE_OBJECT:
@@ -705,7 +846,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_VAR: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getCachedVar(*instruction);
 		if (false && /*var->_type==VAL_OBJECT ||*/ var->_type == VAL_NATIVE) {
 			_operand->setReference(var);
 			_stack->push(_operand);
@@ -716,15 +857,14 @@ bool ScScript::executeInstruction() {
 	}
 
 	case II_PUSH_VAR_REF: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getCachedVar(*instruction);
 		_operand->setReference(var);
 		_stack->push(_operand);
 		break;
 	}
 
 	case II_POP_VAR: {
-		char *varName = _symbols[getDWORD()];
-		ScValue *var = getVar(varName);
+		ScValue *var = getCachedVar(*instruction);
 		if (var) {
 			ScValue *val = _stack->pop();
 			if (!val) {
@@ -750,21 +890,21 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_INT:
-		_stack->pushInt((int)getDWORD());
+		_stack->pushInt((int)dw);
 		break;
 
 	case II_PUSH_FLOAT:
-		_stack->pushFloat(getFloat());
+		_stack->pushFloat(instruction->operand.f);
 		break;
 
 
 	case II_PUSH_BOOL:
-		_stack->pushBool(getDWORD() != 0);
+		_stack->pushBool(dw != 0);
 
 		break;
 
 	case II_PUSH_STRING:
-		_stack->pushString(getString());
+		_stack->pushString(instruction->operand.str);
 		break;
 
 	case II_PUSH_NULL:
@@ -777,7 +917,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_THIS:
-		_operand->setReference(getVar(_symbols[getDWORD()]));
+		_operand->setReference(getCachedVar(*instruction));
 		_thisStack->push(_operand);
 		break;
 
@@ -821,11 +961,10 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_JMP:
-		_iP = getDWORD();
+		_iP = dw;
 		break;
 
 	case II_JMP_FALSE: {
-		dw = getDWORD();
 		//if (!_stack->pop()->getBool()) _iP = dw;
 		ScValue *val = _stack->pop();
 		if (!val) {
@@ -1092,7 +1231,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_DBG_LINE: {
-		int newLine = getDWORD();
+		int newLine = dw;
 		if (newLine != _currentLine) {
 			_currentLine = newLine;
 		}
@@ -1100,7 +1239,7 @@ bool ScScript::executeInstruction() {
 
 	}
 	default:
-		_gameRef->LOG(0, "Fatal: Invalid instruction %d ('%s', line %d, IP:0x%x)\n", inst, _filename, _currentLine, _iP - sizeof(uint32));
+		_gameRef->LOG(0, "Fatal: Invalid instruction %d ('%s', line %d, IP:0x%x)\n", inst, _filename, _currentLine, instruction->pos);
 		_state = SCRIPT_FINISHED;
 		ret = STATUS_FAILED;
 	} // switch(instruction)
@@ -1136,27 +1275,53 @@ uint32 ScScript::getMethodPos(const Common::String &name) const {
 
 //////////////////////////////////////////////////////////////////////////
 ScValue *ScScript::getVar(char *name) {
+	return getVar(Common::String(name));
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScScript::getCachedVar(const DecodedInstruction &instruction) {
+	if (instruction.cache == kNoVariableCache) {
+		return getVar(_symbols[instruction.operand.dw]);
+	}
+
+	ScValue *scope = _scopeStack->_sP >= 0 ? _scopeStack->getTop() : nullptr;
+	VariableCache &cache = _variableCaches[instruction.cache];
+	if (cache.generation == ScValue::getPropGeneration() && cache.scope == scope) {
+		return cache.var;
+	}
+
+	ScValue *var = getVar(_engine->getAtomName(_symbolAtoms[instruction.operand.dw]));
+
+	// A reference can be redirected without any property changing, so
+	// lookups through it can not be cached
+	if (!scope || scope->_type != VAL_VARIABLE_REF) {
+		cache.scope = scope;
+		cache.var = var;
+		cache.generation = ScValue::getPropGeneration();
+	}
+	return var;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScScript::getVar(const Common::String &key) {
 	ScValue *ret = nullptr;
+	const char *name = key.c_str();
 
 	// scope locals
 	if (_scopeStack->_sP >= 0) {
-		if (_scopeStack->getTop()->propExists(name)) {
-			ret = _scopeStack->getTop()->getProp(name);
-		}
+		ret = _scopeStack->getTop()->findProp(key);
 	}
 
 	// script globals
 	if (ret == nullptr) {
-		if (_globals->propExists(name)) {
-			ret = _globals->getProp(name);
-		}
+		ret = _globals->findProp(key);
 	}
 
 	// engine globals
 	if (ret == nullptr) {
-		if (_engine->_globals->propExists(name)) {
-			ret = _engine->_globals->getProp(name);
-		}
+		ret = _engine->_globals->findProp(key);
 	}
 
 	if (ret == nullptr) {
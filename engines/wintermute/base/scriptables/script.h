@@ -34,6 +34,7 @@
 #include "engines/wintermute/base/scriptables/dcscript.h"   // Added by ClassView
 #include "engines/wintermute/coll_templ.h"
 #include "engines/wintermute/persistent.h"
+#include "common/array.h"
 
 namespace Wintermute {
 class BaseScriptHolder;
@@ -165,6 +166,50 @@ private:
 	bool initScript();
 	bool initTables();
 
+	enum {
+		/** DecodedInstruction::cache of instructions without a variable cache */
+		kNoVariableCache = 0xFFFFFFFF
+	};
+
+	/** Result of the last variable lookup of an instruction, see getCachedVar() */
+	struct VariableCache {
+		ScValue *scope;
+		ScValue *var;
+		uint32 generation;
+	};
+
+	/** An instruction with its operand read from the script buffer */
+	struct DecodedInstruction {
+		uint32 pos;  /**< Offset of the instruction in the script buffer */
+		uint32 next; /**< Offset of the following instruction */
+		uint32 inst;
+		uint32 cache; /**< Index into _variableCaches, or kNoVariableCache */
+		union {
+			uint32 dw;
+			double f;
+			const char *str;
+		} operand;
+	};
+
+	/**
+	 * Instructions of the code block in the order of their offsets. The
+	 * instruction pointer stays a byte offset into the script buffer, this
+	 * only saves decoding each instruction again whenever it is run.
+	 */
+	Common::Array<DecodedInstruction> _decodedInstructions;
+	Common::Array<VariableCache> _variableCaches;
+	/** Atom of every symbol, see ScEngine::internAtom() */
+	Common::Array<uint32> _symbolAtoms;
+	bool _decoded;
+	/** Index of the instruction expected to be run next */
+	uint32 _nextDecodedInstruction;
+
+	void decodeScript();
+	void decodeInstruction(uint32 pos, DecodedInstruction &instruction);
+	const DecodedInstruction *findDecodedInstruction(uint32 pos);
+	ScValue *getVar(const Common::String &name);
+	ScValue *getCachedVar(const DecodedInstruction &instruction);
+
 	virtual void preInstHook(uint32 inst);
 	virtual void postInstHook(uint32 inst);
 };
@@ -34,6 +34,8 @@
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/utils/utils.h"
+#include "common/algorithm.h"
+#include "common/util.h"
 
 namespace Wintermute {
 
@@ -339,33 +341,31 @@ bool ScEngine::tick() {
 		}
 
 		// time sliced script
+		bool isProfiling = _isProfiling;
+		uint64 profilingStart = isProfiling ? g_system->getMicros() : 0;
+		uint32 instructions = 0;
+
 		if (_scripts[i]->_timeSlice > 0) {
 			uint32 startTime = g_system->getMillis();
 			while (_scripts[i]->_state == SCRIPT_RUNNING && g_system->getMillis() - startTime < _scripts[i]->_timeSlice) {
 				_currentScript = _scripts[i];
 				_scripts[i]->executeInstruction();
-			}
-			if (_isProfiling && _scripts[i]->_filename) {
-				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime);
+				instructions++;
 			}
 		}
 
 		// normal script
 		else {
-			uint32 startTime = 0;
-			bool isProfiling = _isProfiling;
-			if (isProfiling) {
-				startTime = g_system->getMillis();
-			}
-
 			while (_scripts[i]->_state == SCRIPT_RUNNING) {
 				_currentScript = _scripts[i];
 				_scripts[i]->executeInstruction();
-			}
-			if (isProfiling && _scripts[i]->_filename) {
-				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime);
+				instructions++;
 			}
 		}
+
+		if (isProfiling) {
+			addScriptTime(_scripts[i], (uint32)(g_system->getMicros() - profilingStart), instructions);
+		}
 		_currentScript = nullptr;
 	}
 
@@ -572,14 +572,20 @@ bool ScEngine::clearGlobals(bool includingNatives) {
 }
 
 //////////////////////////////////////////////////////////////////////////
-void ScEngine::addScriptTime(const char *filename, uint32 time) {
-	if (!_isProfiling) {
+void ScEngine::addScriptTime(const ScScript *script, uint32 micros, uint32 instructions) {
+	if (!_isProfiling || !script->_filename) {
 		return;
 	}
 
-	AnsiString fileName = filename;
-	fileName.toLowercase();
-	_scriptTimes[fileName] += time;
+	AnsiString name = script->_filename;
+	name.toLowercase();
+	if (script->_threadEvent) {
+		name += Common::String::format(" (%s%s)", script->_threadEvent, script->_methodThread ? "()" : "");
+	}
+
+	ScriptTime &scriptTime = _scriptTimes[name];
+	scriptTime.micros += micros;
+	scriptTime.instructions += instructions;
 }
 
 
@@ -592,7 +598,7 @@ void ScEngine::enableProfiling() {
 	// destroy old data, if any
 	_scriptTimes.clear();
 
-	_profilingStartTime = g_system->getMillis();
+	_profilingStartTime = g_system->getMicros();
 	_isProfiling = true;
 }
 
@@ -609,28 +615,50 @@ void ScEngine::disableProfiling() {
 
 
 //////////////////////////////////////////////////////////////////////////
-void ScEngine::dumpStats() {
-	error("DumpStats not ported to ScummVM yet");
-	/*  uint32 totalTime = g_system->getMillis() - _profilingStartTime;
+struct ScriptTimeEntry {
+	uint64 micros;
+	Common::String name;
+};
 
-	    typedef std::vector <std::pair<uint32, std::string> > TimeVector;
-	    TimeVector times;
+static bool compareScriptTimes(const ScriptTimeEntry &a, const ScriptTimeEntry &b) {
+	return a.micros > b.micros;
+}
 
-	    ScriptTimes::iterator it;
-	    for (it = _scriptTimes.begin(); it != _scriptTimes.end(); ++it) {
-	        times.push_back(std::pair<uint32, std::string> (it->_value, it->_key));
-	    }
-	    std::sort(times.begin(), times.end());
+void ScEngine::dumpStats() {
+	const uint64 totalTime = MAX<uint64>(g_system->getMicros() - _profilingStartTime, 1);
+
+	Common::Array<ScriptTimeEntry> times;
+	for (ScriptTimes::const_iterator it = _scriptTimes.begin(); it != _scriptTimes.end(); ++it) {
+		ScriptTimeEntry entry;
+		entry.micros = it->_value.micros;
+		entry.name = it->_key;
+		times.push_back(entry);
+	}
+	Common::sort(times.begin(), times.end(), compareScriptTimes);
 
+	_gameRef->LOG(0, "***** Script profiling information: *****");
+	_gameRef->LOG(0, "  %-50s %10.3fs", "Total execution time", totalTime / 1000000.0);
 
-	    TimeVector::reverse_iterator tit;
+	for (uint i = 0; i < times.size(); i++) {
+		const ScriptTime &scriptTime = _scriptTimes[times[i].name];
+		_gameRef->LOG(0, "  %-50s %10.3fs (%6.2f%%) %12.0f instructions", times[i].name.c_str(),
+		              scriptTime.micros / 1000000.0, scriptTime.micros * 100.0 / totalTime,
+		              (double)scriptTime.instructions);
+	}
+}
 
-	    _gameRef->LOG(0, "***** Script profiling information: *****");
-	    _gameRef->LOG(0, "  %-40s %fs", "Total execution time", (float)totalTime / 1000);
+//////////////////////////////////////////////////////////////////////////
+uint32 ScEngine::internAtom(const char *name) {
+	const Common::String key(name);
+	Common::HashMap<Common::String, uint32>::const_iterator it = _atoms.find(key);
+	if (it != _atoms.end()) {
+		return it->_value;
+	}
 
-	    for (tit = times.rbegin(); tit != times.rend(); ++tit) {
-	        _gameRef->LOG(0, "  %-40s %fs (%f%%)", tit->second.c_str(), (float)tit->first / 1000, (float)tit->first / (float)totalTime * 100);
-	    }*/
+	const uint32 atom = _atomNames.size();
+	_atomNames.push_back(key);
+	_atoms[key] = atom;
+	return atom;
 }
 
 } // End of namespace Wintermute
@@ -102,16 +102,40 @@ public:
 		return _isProfiling;
 	}
 
-	void addScriptTime(const char *filename, uint32 Time);
+	/**
+	 * Account a slice of script execution to the script, or to the event or
+	 * method it is running.
+	 * @param micros the time taken, in microseconds
+	 * @param instructions the number of instructions executed
+	 */
+	void addScriptTime(const ScScript *script, uint32 micros, uint32 instructions);
 	void dumpStats();
 
+	/**
+	 * Get the atom of a symbol name. Scripts share the atoms of equal names,
+	 * so every name is only stored once.
+	 */
+	uint32 internAtom(const char *name);
+	const Common::String &getAtomName(uint32 atom) const {
+		return _atomNames[atom];
+	}
+
 private:
+	Common::HashMap<Common::String, uint32> _atoms;
+	Common::Array<Common::String> _atomNames;
 
 	CScCachedScript *_cachedScripts[MAX_CACHED_SCRIPTS];
 	bool _isProfiling;
-	uint32 _profilingStartTime;
+	uint64 _profilingStartTime;
+
+	struct ScriptTime {
+		uint64 micros;
+		uint64 instructions;
+
+		ScriptTime() : micros(0), instructions(0) {}
+	};
 
-	typedef Common::HashMap<Common::String, uint32> ScriptTimes;
+	typedef Common::HashMap<Common::String, ScriptTime> ScriptTimes;
 	ScriptTimes _scriptTimes;
 
 };
@@ -42,6 +42,8 @@ namespace Wintermute {
 
 IMPLEMENT_PERSISTENT(ScValue, false)
 
+uint32 ScValue::_propGeneration = 1;
+
 //////////////////////////////////////////////////////////////////////////
 ScValue::ScValue(BaseGame *inGame) : BaseClass(inGame) {
 	_type = VAL_NULL;
@@ -201,6 +203,7 @@ bool ScValue::deleteProp(const char *name) {
 	if (_valIter != _valObject.end()) {
 		delete _valIter->_value;
 		_valIter->_value = nullptr;
+		_propGeneration++;
 	}
 
 	return STATUS_OK;
@@ -228,6 +231,7 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 		}
 		if (!newVal) {
 			newVal = new ScValue(_gameRef);
+			_propGeneration++;
 		} else {
 			newVal->cleanup();
 		}
@@ -259,6 +263,19 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScValue::findProp(const Common::String &name) {
+	if (_type == VAL_VARIABLE_REF) {
+		return _valRef->findProp(name);
+	}
+	_valIter = _valObject.find(name);
+	if (_valIter != _valObject.end()) {
+		return _valIter->_value;
+	}
+	return nullptr;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::propExists(const char *name) {
 	if (_type == VAL_VARIABLE_REF) {
@@ -272,6 +289,9 @@ bool ScValue::propExists(const char *name) {
 
 //////////////////////////////////////////////////////////////////////////
 void ScValue::deleteProps() {
+	if (!_valObject.empty()) {
+		_propGeneration++;
+	}
 	_valIter = _valObject.begin();
 	while (_valIter != _valObject.end()) {
 		delete(ScValue *)_valIter->_value;
@@ -741,6 +761,7 @@ void ScValue::copy(ScValue *orig, bool copyWhole) {
 
 	// copy properties
 	if (orig->_type == VAL_OBJECT && orig->_valObject.size() > 0) {
+		_propGeneration++;
 		orig->_valIter = orig->_valObject.begin();
 		while (orig->_valIter != orig->_valObject.end()) {
 			_valObject[orig->_valIter->_key] = new ScValue(_gameRef);
@@ -815,6 +836,7 @@ bool ScValue::persist(BasePersistenceManager *persistMgr) {
 	} else {
 		ScValue *val = nullptr;
 		persistMgr->transferSint32("", &size);
+		_propGeneration++;
 		for (int i = 0; i < size; i++) {
 			persistMgr->transferConstChar("", &str);
 			persistMgr->transferPtr("", &val);
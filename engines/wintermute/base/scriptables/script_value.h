@@ -83,9 +83,24 @@ public:
 	bool isObject();
 	bool setProp(const char *name, ScValue *val, bool copyWhole = false, bool setAsConst = false);
 	ScValue *getProp(const char *name);
+	/**
+	 * Get a property stored in the value itself, like propExists() followed
+	 * by getProp() but with a single lookup. Properties provided by native
+	 * objects are not considered.
+	 */
+	ScValue *findProp(const Common::String &name);
+	/**
+	 * Get a counter which changes whenever a property is added to or removed
+	 * from any value. A variable found by findProp() stays the same as long
+	 * as the counter does not change.
+	 */
+	static uint32 getPropGeneration() {
+		return _propGeneration;
+	}
 	BaseScriptable *_valNative;
 	ScValue *_valRef;
 private:
+	static uint32 _propGeneration;
 	bool _valBool;
 	int32 _valInt;
 	double _valFloat;
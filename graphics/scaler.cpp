@@ -20,6 +20,7 @@
  *
  */
 
+#include "graphics/scaler.h"
 #include "graphics/scaler/intern.h"
 #include "graphics/scaler/scalebit.h"
 #include "common/util.h"
@@ -159,6 +160,16 @@ void DestroyScalers() {
 #endif
 }
 
+bool isScalerReentrant(ScalerProc *scalerProc) {
+#if defined(USE_HQ_SCALERS) && defined(USE_NASM)
+	// The assembly versions of the HQ scalers keep their working state in
+	// global variables
+	if (scalerProc == HQ2x || scalerProc == HQ3x)
+		return false;
+#endif
+	return true;
+}
+
 
 /**
  * Trivial 'scaler' - in fact it doesn't do any scaling but just copies the
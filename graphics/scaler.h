@@ -61,6 +61,12 @@ DECLARE_SCALER(HQ3x);
 
 #endif // #ifdef USE_SCALERS
 
+/**
+ * Check whether a scaler may run on several parts of the same image at
+ * the same time, i.e. whether it keeps no state in global variables.
+ */
+extern bool isScalerReentrant(ScalerProc *scalerProc);
+
 // creates a 160x100 thumbnail for 320x200 games
 // and 160x120 thumbnail for 320x240 and 640x480 games
 // only 565 mode
@@ -26,6 +26,18 @@
 #include "common/scummsys.h"
 #include "graphics/colormasks.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define USE_SSE2_HQ_PATTERN
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define USE_NEON_HQ_PATTERN
+#include <arm_neon.h>
+#endif
+
+#if defined(USE_SSE2_HQ_PATTERN) || defined(USE_NEON_HQ_PATTERN)
+#define USE_SIMD_HQ_PATTERN
+#endif
+
 
 /**
  * Interpolate two 16 bit pixel *pairs* at once with equal weights 1.
@@ -524,4 +536,60 @@ static inline bool diffYUV(int yuv1, int yuv2) {
 */
 }
 
+#ifdef USE_SIMD_HQ_PATTERN
+/**
+ * Compute the neighbourhood pattern used by the hq scaler family: bit n is
+ * set if the n-th neighbour (in the order w1, w2, w3, w4, w6, w7, w8, w9)
+ * differs from the center pixel according to diffYUV. All eight
+ * comparisons are done at once, byte by byte on the packed Y, U and V
+ * components, which gives exactly the same result as diffYUV.
+ */
+static inline int patternYUV(uint32 yuv5, uint32 yuv1, uint32 yuv2, uint32 yuv3, uint32 yuv4,
+                             uint32 yuv6, uint32 yuv7, uint32 yuv8, uint32 yuv9) {
+	// Per-byte thresholds for V, U and Y; the top byte is always zero
+	static const uint32 kThreshold = 0x00300706;
+
+#ifdef USE_SSE2_HQ_PATTERN
+	const __m128i center = _mm_set1_epi32(yuv5);
+	const __m128i threshold = _mm_set1_epi32(kThreshold);
+	const __m128i zero = _mm_setzero_si128();
+
+	const __m128i lo = _mm_set_epi32(yuv4, yuv3, yuv2, yuv1);
+	const __m128i hi = _mm_set_epi32(yuv9, yuv8, yuv7, yuv6);
+
+	// Absolute byte differences, then the amount by which they exceed the
+	// threshold. A component differs if the latter is not zero.
+	const __m128i diffLo = _mm_or_si128(_mm_subs_epu8(lo, center), _mm_subs_epu8(center, lo));
+	const __m128i diffHi = _mm_or_si128(_mm_subs_epu8(hi, center), _mm_subs_epu8(center, hi));
+	const __m128i sameLo = _mm_cmpeq_epi32(_mm_subs_epu8(diffLo, threshold), zero);
+	const __m128i sameHi = _mm_cmpeq_epi32(_mm_subs_epu8(diffHi, threshold), zero);
+
+	const int same = _mm_movemask_ps(_mm_castsi128_ps(sameLo)) |
+	                 (_mm_movemask_ps(_mm_castsi128_ps(sameHi)) << 4);
+	return ~same & 0xFF;
+#else
+	static const uint32 kBitsLo[4] = { 0x01, 0x02, 0x04, 0x08 };
+	static const uint32 kBitsHi[4] = { 0x10, 0x20, 0x40, 0x80 };
+	const uint32 neighboursLo[4] = { yuv1, yuv2, yuv3, yuv4 };
+	const uint32 neighboursHi[4] = { yuv6, yuv7, yuv8, yuv9 };
+
+	const uint8x16_t center = vreinterpretq_u8_u32(vdupq_n_u32(yuv5));
+	const uint8x16_t threshold = vreinterpretq_u8_u32(vdupq_n_u32(kThreshold));
+
+	const uint8x16_t overLo = vcgtq_u8(vabdq_u8(vreinterpretq_u8_u32(vld1q_u32(neighboursLo)), center), threshold);
+	const uint8x16_t overHi = vcgtq_u8(vabdq_u8(vreinterpretq_u8_u32(vld1q_u32(neighboursHi)), center), threshold);
+
+	// Turn every lane with any differing component into its pattern bit
+	const uint32x4_t lanesLo = vreinterpretq_u32_u8(overLo);
+	const uint32x4_t lanesHi = vreinterpretq_u32_u8(overHi);
+	const uint32x4_t bits = vorrq_u32(vandq_u32(vtstq_u32(lanesLo, lanesLo), vld1q_u32(kBitsLo)),
+	                                  vandq_u32(vtstq_u32(lanesHi, lanesHi), vld1q_u32(kBitsHi)));
+
+	uint32x2_t sum = vorr_u32(vget_low_u32(bits), vget_high_u32(bits));
+	sum = vpadd_u32(sum, sum);
+	return vget_lane_u32(sum, 0);
+#endif
+}
+#endif
+
 #endif
@@ -33,6 +33,7 @@ DECLARE_SINGLETON(GUI::EventRecorder);
 #include "backends/timer/sdl/sdl-timer.h"
 #include "backends/mixer/sdl/sdl-mixer.h"
 #include "common/config-manager.h"
+#include "common/file.h"
 #include "common/md5.h"
 #include "gui/gui-manager.h"
 #include "gui/widget.h"
@@ -40,6 +41,7 @@ DECLARE_SINGLETON(GUI::EventRecorder);
 #include "common/random.h"
 #include "common/savefile.h"
 #include "common/textconsole.h"
+#include "common/util.h"
 #include "graphics/thumbnail.h"
 #include "graphics/surface.h"
 #include "graphics/scaler.h"
@@ -89,6 +91,12 @@ EventRecorder::EventRecorder() {
 	_screenshotPeriod = 0;
 	_playbackFile = nullptr;
 
+	_benchmark = false;
+	_benchmarkStart = 0;
+	_benchmarkFrameEnd = 0;
+	_benchmarkUpdateStart = 0;
+	_benchmarkMix = 0;
+
 	DebugMan.addDebugChannel(kDebugLevelEventRec, "EventRec", "Event recorder debug level");
 }
 
@@ -101,6 +109,9 @@ void EventRecorder::deinit() {
 		return;
 	}
 	setFileHeader();
+	if (_benchmark) {
+		finishBenchmark();
+	}
 	_needRedraw = false;
 	_initialized = false;
 	_recordMode = kPassthrough;
@@ -152,6 +163,11 @@ void EventRecorder::processMillis(uint32 &millis, bool skipRecord) {
 			_timerManager->handler();
 		} else {
 			if (_nextEvent.type == Common::EVENT_RTL) {
+				if (_benchmark) {
+					finishBenchmark();
+					debugC(1, kDebugLevelEventRec, "playback:action=stopplayback");
+					g_system->quit();
+				}
 				error("playback:action=stopplayback");
 			} else {
 				uint32 seconds = _fakeTimer / 1000;
@@ -304,6 +320,59 @@ void EventRecorder::init(Common::String recordFileName, RecordMode mode) {
 	_initialized = true;
 }
 
+void EventRecorder::initBenchmark(const Common::String &recordFileName) {
+	_benchmark = true;
+	_benchmarkCSV = ConfMan.get("benchmark_csv");
+	_benchmarkFrames.clear();
+	_benchmarkMix = 0;
+	init(recordFileName, kRecorderPlayback);
+	_fastPlayback = true;
+	_needRedraw = false;
+	_benchmarkStart = _benchmarkFrameEnd = g_system->getMicros();
+	debugC(1, kDebugLevelEventRec, "playback:action=benchmark filename=%s", recordFileName.c_str());
+}
+
+void EventRecorder::finishBenchmark() {
+	_benchmark = false;
+
+	const uint frames = _benchmarkFrames.size();
+	const uint64 wallTime = g_system->getMicros() - _benchmarkStart;
+	debug("benchmark:frames=%u virtual_ms=%u wall_ms=%u", frames, _fakeTimer, (uint32)(wallTime / 1000));
+	if (!frames) {
+		return;
+	}
+
+	static const char *const stageNames[] = { "engine", "update", "mix" };
+	for (int stage = 0; stage < ARRAYSIZE(stageNames); ++stage) {
+		uint64 sum = 0;
+		uint32 minTime = 0xFFFFFFFF, maxTime = 0;
+		for (uint i = 0; i < frames; ++i) {
+			const BenchmarkFrame &frame = _benchmarkFrames[i];
+			const uint32 value = stage == 0 ? frame.engine : (stage == 1 ? frame.update : frame.mix);
+			sum += value;
+			minTime = MIN(minTime, value);
+			maxTime = MAX(maxTime, value);
+		}
+		debug("benchmark:stage=%s total_ms=%u mean_us=%u min_us=%u max_us=%u", stageNames[stage],
+		      (uint32)(sum / 1000), (uint32)(sum / frames), minTime, maxTime);
+	}
+
+	if (!_benchmarkCSV.empty()) {
+		Common::DumpFile file;
+		if (file.open(_benchmarkCSV)) {
+			file.writeString("frame,engine_us,update_us,mix_us\n");
+			for (uint i = 0; i < frames; ++i) {
+				const BenchmarkFrame &frame = _benchmarkFrames[i];
+				file.writeString(Common::String::format("%u,%u,%u,%u\n", i, frame.engine, frame.update, frame.mix));
+			}
+			file.flush();
+		}
+		if (!file.isOpen() || file.err()) {
+			warning("benchmark:action=error reason=\"Could not write %s\"", _benchmarkCSV.c_str());
+		}
+	}
+	_benchmarkFrames.clear();
+}
 
 /**
  * Opens or creates file depend of recording mode.
@@ -429,7 +498,13 @@ void EventRecorder::updateSubsystems() {
 	}
 	RecordMode oldRecordMode = _recordMode;
 	_recordMode = kPassthrough;
-	_fakeMixerManager->update();
+	if (_benchmark) {
+		const uint64 mixStart = g_system->getMicros();
+		_fakeMixerManager->update();
+		_benchmarkMix += (uint32)(g_system->getMicros() - mixStart);
+	} else {
+		_fakeMixerManager->update();
+	}
 	_recordMode = oldRecordMode;
 }
 
@@ -550,6 +625,10 @@ Common::SaveFileManager *EventRecorder::getSaveManager(Common::SaveFileManager *
 }
 
 void EventRecorder::preDrawOverlayGui() {
+	if (_benchmark) {
+		_benchmarkUpdateStart = g_system->getMicros();
+		return;
+	}
 	if ((_initialized) || (_needRedraw)) {
 		RecordMode oldMode = _recordMode;
 		_recordMode = kPassthrough;
@@ -566,6 +645,19 @@ void EventRecorder::preDrawOverlayGui() {
 }
 
 void EventRecorder::postDrawOverlayGui() {
+	if (_benchmark) {
+		const uint64 now = g_system->getMicros();
+		// Whatever was not spent mixing since the previous frame was spent in the engine
+		const uint32 interval = (uint32)(_benchmarkUpdateStart - _benchmarkFrameEnd);
+		BenchmarkFrame frame;
+		frame.engine = interval > _benchmarkMix ? interval - _benchmarkMix : 0;
+		frame.update = (uint32)(now - _benchmarkUpdateStart);
+		frame.mix = _benchmarkMix;
+		_benchmarkFrames.push_back(frame);
+		_benchmarkFrameEnd = now;
+		_benchmarkMix = 0;
+		return;
+	}
     if ((_initialized) || (_needRedraw)) {
 		RecordMode oldMode = _recordMode;
 		_recordMode = kPassthrough;
@@ -78,6 +78,18 @@ public:
 	};
 
 	void init(Common::String recordFileName, RecordMode mode);
+
+	/**
+	 * Play back a recording as fast as possible and report the time spent
+	 * per frame in the engine, in updateScreen() and in mixing audio.
+	 *
+	 * Playback runs on the virtual clock of the recording, so the engine
+	 * sees exactly the same timing as during recording. The report is
+	 * printed as "benchmark:" lines when the recording ends, and the
+	 * per-frame times are also written to the file set by the
+	 * "benchmark_csv" config key.
+	 */
+	void initBenchmark(const Common::String &recordFileName);
 	void deinit();
 	bool processDelayMillis();
 	uint32 getRandomSeed(const Common::String &name);
@@ -175,6 +187,12 @@ public:
 	void switchFastMode();
 
 private:
+	struct BenchmarkFrame {
+		uint32 engine;
+		uint32 update;
+		uint32 mix;
+	};
+
 	bool pollEvent(Common::Event &ev) override;
 	bool notifyEvent(const Common::Event &event) override;
 	bool _initialized;
@@ -227,6 +245,16 @@ private:
 	Common::String _recordFileName;
 	bool _fastPlayback;
 	bool _needRedraw;
+
+	void finishBenchmark();
+
+	bool _benchmark;
+	Common::String _benchmarkCSV;
+	Common::Array<BenchmarkFrame> _benchmarkFrames;
+	uint64 _benchmarkStart;
+	uint64 _benchmarkFrameEnd;
+	uint64 _benchmarkUpdateStart;
+	uint32 _benchmarkMix;
 };
 
 } // End of namespace GUI
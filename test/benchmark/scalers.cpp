@@ -0,0 +1,126 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+/*
+ * Simple benchmark of the scalers in graphics/scaler.
+ *
+ * Every scaler is run repeatedly over a synthetic 320x200 RGB565 image and
+ * the average time per frame is printed. Use the 'scaler-benchmark' target
+ * to build and run it.
+ */
+
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+#include <stdio.h>
+#include <time.h>
+
+#include "common/scummsys.h"
+#include "graphics/scaler.h"
+
+namespace {
+
+enum {
+	kWidth = 320,
+	kHeight = 200,
+	kMaxScale = 3,
+	kFrames = 200
+};
+
+struct ScalerEntry {
+	const char *name;
+	ScalerProc *proc;
+	int scale;
+};
+
+const ScalerEntry scalers[] = {
+	{ "Normal1x", Normal1x, 1 },
+#ifdef USE_SCALERS
+	{ "Normal2x", Normal2x, 2 },
+	{ "Normal3x", Normal3x, 3 },
+	{ "2xSaI", _2xSaI, 2 },
+	{ "Super2xSaI", Super2xSaI, 2 },
+	{ "SuperEagle", SuperEagle, 2 },
+	{ "AdvMame2x", AdvMame2x, 2 },
+	{ "AdvMame3x", AdvMame3x, 3 },
+	{ "TV2x", TV2x, 2 },
+	{ "DotMatrix", DotMatrix, 2 },
+#ifdef USE_HQ_SCALERS
+	{ "HQ2x", HQ2x, 2 },
+	{ "HQ3x", HQ3x, 3 },
+#endif
+#endif
+	{ 0, 0, 0 }
+};
+
+/**
+ * Fill the source with a mix of flat areas, gradients and noise, so that
+ * the edge detecting scalers take all kinds of paths.
+ */
+void fillSource(uint16 *src, int pitch, int width, int height) {
+	uint32 seed = 0x12345678;
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			seed = seed * 1103515245 + 12345;
+			uint16 color;
+			if ((x / 32 + y / 32) & 1)
+				color = (uint16)(seed >> 16);
+			else if (x < width / 2)
+				color = (uint16)(((x & 0x1F) << 11) | ((y & 0x3F) << 5));
+			else
+				color = 0x39E7;
+			src[y * pitch + x] = color;
+		}
+	}
+}
+
+} // End of anonymous namespace
+
+int main(int argc, char *argv[]) {
+	// The scalers access one pixel around the area to scale, two to the
+	// right and below for the 2xSaI family.
+	const int srcPitch = kWidth + 4;
+	const int dstPitch = kWidth * kMaxScale;
+	uint16 *src = new uint16[srcPitch * (kHeight + 4)];
+	uint16 *dst = new uint16[dstPitch * kHeight * kMaxScale];
+
+	fillSource(src, srcPitch, kWidth + 4, kHeight + 4);
+	InitScalers(565);
+
+	printf("%-12s %12s %12s\n", "Scaler", "ms/frame", "Mpixel/s");
+	for (const ScalerEntry *entry = scalers; entry->name; ++entry) {
+		const clock_t start = clock();
+		for (int i = 0; i < kFrames; ++i) {
+			entry->proc((const uint8 *)(src + srcPitch + 1), srcPitch * 2,
+			            (uint8 *)dst, dstPitch * 2, kWidth, kHeight);
+		}
+		const double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+		const double msPerFrame = seconds * 1000.0 / kFrames;
+		const double mpixels = seconds > 0.0 ? (double)kWidth * kHeight * kFrames / seconds / 1000000.0 : 0.0;
+
+		printf("%-12s %12.3f %12.1f\n", entry->name, msPerFrame, mpixels);
+	}
+
+	DestroyScalers();
+	delete[] src;
+	delete[] dst;
+	return 0;
+}
@@ -0,0 +1,385 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/rect.h"
+
+#include "engines/sci/graphics/celrows32.h"
+
+namespace CelRows32Legacy {
+
+// The per-pixel scalers, mapper and renderer which drew SCI32 cels before
+// rows were drawn in one go, as they were in celobj32.cpp. Only the
+// constructors of the scalers differ, since the originals need a CelObj,
+// and the debug bounds checks are left out.
+
+struct Buffer {
+	byte *pixels;
+	int16 w;
+
+	void *getPixels() const { return pixels; }
+};
+
+template<bool FLIP, typename READER>
+struct SCALER_NoScale {
+	const byte *_row;
+	READER _reader;
+	const int16 _lastIndex;
+	const int16 _sourceX;
+	const int16 _sourceY;
+
+	SCALER_NoScale(const READER &reader, const int16 celWidth, const Common::Point &scaledPosition) :
+	_row(nullptr),
+	_reader(reader),
+	_lastIndex(celWidth - 1),
+	_sourceX(scaledPosition.x),
+	_sourceY(scaledPosition.y) {}
+
+	inline void setTarget(const int16 x, const int16 y) {
+		_row = _reader.getRow(y - _sourceY);
+
+		if (FLIP) {
+			_row += _lastIndex - (x - _sourceX);
+		} else {
+			_row += x - _sourceX;
+		}
+	}
+
+	inline byte read() {
+		if (FLIP) {
+			return *_row--;
+		} else {
+			return *_row++;
+		}
+	}
+};
+
+template<typename READER>
+struct SCALER_Scale {
+	const byte *_row;
+	READER _reader;
+	const int16 *_valuesX;
+	const int16 *_valuesY;
+	int16 _x;
+
+	SCALER_Scale(const READER &reader, const int16 *valuesX, const int16 *valuesY) :
+	_row(nullptr),
+	_reader(reader),
+	_valuesX(valuesX),
+	_valuesY(valuesY),
+	_x(0) {}
+
+	inline void setTarget(const int16 x, const int16 y) {
+		_row = _reader.getRow(_valuesY[y]);
+		_x = x;
+	}
+
+	inline byte read() {
+		return _row[_valuesX[_x++]];
+	}
+};
+
+struct MAPPER_NoMD {
+	inline void draw(byte *target, const byte pixel, const uint8 skipColor) const {
+		if (pixel != skipColor) {
+			*target = pixel;
+		}
+	}
+};
+
+template<typename MAPPER, typename SCALER, bool DRAW_BLACK_LINES>
+struct RENDERER {
+	MAPPER &_mapper;
+	SCALER &_scaler;
+	const uint8 _skipColor;
+
+	RENDERER(MAPPER &mapper, SCALER &scaler, const uint8 skipColor) :
+	_mapper(mapper),
+	_scaler(scaler),
+	_skipColor(skipColor) {}
+
+	inline void draw(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const {
+		byte *targetPixel = (byte *)target.getPixels() + target.w * targetRect.top + targetRect.left;
+
+		const int16 skipStride = target.w - targetRect.width();
+		const int16 targetWidth = targetRect.width();
+		const int16 targetHeight = targetRect.height();
+		for (int16 y = 0; y < targetHeight; ++y) {
+			if (DRAW_BLACK_LINES && (y % 2) == 0) {
+				memset(targetPixel, 0, targetWidth);
+				targetPixel += targetWidth + skipStride;
+				continue;
+			}
+
+			_scaler.setTarget(targetRect.left, targetRect.top + y);
+
+			for (int16 x = 0; x < targetWidth; ++x) {
+				_mapper.draw(targetPixel++, _scaler.read(), _skipColor);
+			}
+
+			targetPixel += skipStride;
+		}
+	}
+};
+
+} // End of namespace CelRows32Legacy
+
+/**
+ * Checks the row functions used to draw SCI32 cels against the pixel by
+ * pixel renderer, scalers and mapper they replaced, both for single rows and
+ * for whole cels drawn mirrored and scaled.
+ */
+class CelRows32TestSuite : public CxxTest::TestSuite {
+private:
+	enum {
+		kRowWidth = 67,
+		kCelWidth = 23,
+		kCelHeight = 17,
+		kTargetWidth = 80,
+		kTargetHeight = 60
+	};
+
+	byte _cel[kCelHeight][kCelWidth];
+	int16 _valuesX[kTargetWidth];
+	int16 _valuesY[kTargetHeight];
+
+	uint32 _seed;
+
+	// Common::RandomSource needs an OSystem, so use a simple LCG instead
+	uint getRandomNumber(uint max) {
+		_seed = _seed * 1103515245 + 12345;
+		return (_seed >> 8) % (max + 1);
+	}
+
+	// Fills a row with a mix of runs of the skip color, runs of opaque
+	// pixels and single pixels of either, so all code paths get exercised
+	void fillRow(byte *row, int width, byte skipColor) {
+		int x = 0;
+		while (x < width) {
+			const int length = MIN<int>(1 + getRandomNumber(8), width - x);
+			const uint type = getRandomNumber(2);
+			for (int i = 0; i < length; ++i, ++x) {
+				if (type == 0 || (type == 2 && getRandomNumber(1))) {
+					row[x] = skipColor;
+				} else {
+					row[x] = getRandomNumber(255);
+				}
+			}
+		}
+	}
+
+	// Builds the tables of source pixels for a cel scaled to the given size
+	// and placed at x, y, the same way as CelScaler does
+	void buildScaleTables(int16 x, int16 y, int16 width, int16 height, bool mirrored) {
+		for (int16 i = 0; i < width; ++i) {
+			const int16 sourceX = i * kCelWidth / width;
+			_valuesX[x + i] = mirrored ? kCelWidth - 1 - sourceX : sourceX;
+		}
+		for (int16 i = 0; i < height; ++i) {
+			_valuesY[y + i] = i * kCelHeight / height;
+		}
+	}
+
+	struct CelReader {
+		const byte (*_rows)[kCelWidth];
+
+		const byte *getRow(const int16 y) const { return _rows[y]; }
+	};
+
+	template<typename SCALER>
+	void drawPerPixel(byte *target, SCALER &scaler, const Common::Rect &rect, byte skipColor) {
+		// The renderer is never asked to draw empty rects, and a flipped
+		// scaler would point before the cel for one
+		if (rect.isEmpty()) {
+			return;
+		}
+
+		CelRows32Legacy::Buffer buffer = { target, kTargetWidth };
+		CelRows32Legacy::MAPPER_NoMD mapper;
+		CelRows32Legacy::RENDERER<CelRows32Legacy::MAPPER_NoMD, SCALER, false> renderer(mapper, scaler, skipColor);
+		renderer.draw(buffer, rect, Common::Point());
+	}
+
+	// Draws the part of an unscaled cel at x, y inside the given rect the
+	// way the renderer did before rows were drawn in one go, one pixel at a
+	// time
+	void drawUnscaledPerPixel(byte *target, int16 celX, int16 celY, const Common::Rect &rect, bool mirrored, byte skipColor) {
+		const CelReader reader = { _cel };
+		const Common::Point position(celX, celY);
+		if (mirrored) {
+			CelRows32Legacy::SCALER_NoScale<true, CelReader> scaler(reader, kCelWidth, position);
+			drawPerPixel(target, scaler, rect, skipColor);
+		} else {
+			CelRows32Legacy::SCALER_NoScale<false, CelReader> scaler(reader, kCelWidth, position);
+			drawPerPixel(target, scaler, rect, skipColor);
+		}
+	}
+
+	void drawUnscaledRows(byte *target, int16 celX, int16 celY, const Common::Rect &rect, bool mirrored, byte skipColor) {
+		byte buffer[kCelWidth];
+		const int16 width = rect.width();
+		for (int16 y = rect.top; y < rect.bottom; ++y) {
+			const byte *row = _cel[y - celY];
+			if (mirrored) {
+				Sci::copyCelRowMirrored(buffer, row + kCelWidth - 1 - (rect.left - celX), width);
+				row = buffer;
+			} else {
+				row += rect.left - celX;
+			}
+			Sci::copyCelRowSkip(target + y * kTargetWidth + rect.left, row, width, skipColor);
+		}
+	}
+
+	void drawScaledPerPixel(byte *target, const Common::Rect &rect, byte skipColor) {
+		const CelReader reader = { _cel };
+		CelRows32Legacy::SCALER_Scale<CelReader> scaler(reader, _valuesX, _valuesY);
+		drawPerPixel(target, scaler, rect, skipColor);
+	}
+
+	void drawScaledRows(byte *target, Sci::CelRowScaleCache<kTargetWidth> &cache, const Common::Rect &rect, byte skipColor) {
+		for (int16 y = rect.top; y < rect.bottom; ++y) {
+			const byte *row = cache.getRow(_cel[_valuesY[y]], _valuesY[y], _valuesX, rect.left, rect.width());
+			Sci::copyCelRowSkip(target + y * kTargetWidth + rect.left, row, rect.width(), skipColor);
+		}
+	}
+
+	// Gets a random rect inside the given one, possibly empty
+	Common::Rect getRandomRect(const Common::Rect &bounds) {
+		const int16 left = bounds.left + getRandomNumber(bounds.width());
+		const int16 top = bounds.top + getRandomNumber(bounds.height());
+		return Common::Rect(left, top, left + getRandomNumber(bounds.right - left), top + getRandomNumber(bounds.bottom - top));
+	}
+
+	void fillCel(byte skipColor) {
+		for (int y = 0; y < kCelHeight; ++y) {
+			fillRow(_cel[y], kCelWidth, skipColor);
+		}
+	}
+
+	// Draws random cels with the given skip color, or a random one if it is
+	// negative
+	void checkUnscaledCels(int fixedSkipColor) {
+		_seed = 1;
+		byte target[kTargetWidth * kTargetHeight], expected[kTargetWidth * kTargetHeight];
+
+		for (int iteration = 0; iteration < 200; ++iteration) {
+			const byte skipColor = fixedSkipColor < 0 ? getRandomNumber(255) : fixedSkipColor;
+			const bool mirrored = getRandomNumber(1);
+			fillCel(skipColor);
+			for (int i = 0; i < kTargetWidth * kTargetHeight; ++i) {
+				target[i] = expected[i] = getRandomNumber(255);
+			}
+
+			const int16 celX = getRandomNumber(kTargetWidth - kCelWidth);
+			const int16 celY = getRandomNumber(kTargetHeight - kCelHeight);
+			const Common::Rect celRect(celX, celY, celX + kCelWidth, celY + kCelHeight);
+			for (int i = 0; i < 4; ++i) {
+				const Common::Rect rect = getRandomRect(celRect);
+				drawUnscaledPerPixel(expected, celX, celY, rect, mirrored, skipColor);
+				drawUnscaledRows(target, celX, celY, rect, mirrored, skipColor);
+			}
+			TS_ASSERT_SAME_DATA(target, expected, kTargetWidth * kTargetHeight);
+		}
+	}
+
+	void checkScaledCels(int fixedSkipColor) {
+		_seed = 1;
+		byte target[kTargetWidth * kTargetHeight], expected[kTargetWidth * kTargetHeight];
+
+		for (int iteration = 0; iteration < 200; ++iteration) {
+			const byte skipColor = fixedSkipColor < 0 ? getRandomNumber(255) : fixedSkipColor;
+			const bool mirrored = getRandomNumber(1);
+			fillCel(skipColor);
+			for (int i = 0; i < kTargetWidth * kTargetHeight; ++i) {
+				target[i] = expected[i] = getRandomNumber(255);
+			}
+
+			// Covers both upscaling and downscaling
+			const int16 width = 1 + getRandomNumber(kTargetWidth - 1);
+			const int16 height = 1 + getRandomNumber(kTargetHeight - 1);
+			const int16 celX = getRandomNumber(kTargetWidth - width);
+			const int16 celY = getRandomNumber(kTargetHeight - height);
+			buildScaleTables(celX, celY, width, height, mirrored);
+
+			// Like a scaler, the cache lives for all rects drawn in one go
+			Sci::CelRowScaleCache<kTargetWidth> cache;
+			const Common::Rect celRect(celX, celY, celX + width, celY + height);
+			for (int i = 0; i < 4; ++i) {
+				const Common::Rect rect = getRandomRect(celRect);
+				drawScaledPerPixel(expected, rect, skipColor);
+				drawScaledRows(target, cache, rect, skipColor);
+			}
+			TS_ASSERT_SAME_DATA(target, expected, kTargetWidth * kTargetHeight);
+		}
+	}
+
+	void checkCopyRowSkip(int fixedSkipColor) {
+		_seed = 1;
+		byte source[kRowWidth], target[kRowWidth], expected[kRowWidth];
+		const CelRows32Legacy::MAPPER_NoMD mapper;
+
+		for (int iteration = 0; iteration < 1000; ++iteration) {
+			const int16 width = getRandomNumber(kRowWidth);
+			const byte skipColor = fixedSkipColor < 0 ? getRandomNumber(255) : fixedSkipColor;
+			fillRow(source, kRowWidth, skipColor);
+			for (int x = 0; x < kRowWidth; ++x) {
+				target[x] = expected[x] = getRandomNumber(255);
+			}
+
+			for (int x = 0; x < width; ++x) {
+				mapper.draw(expected + x, source[x], skipColor);
+			}
+
+			Sci::copyCelRowSkip(target, source, width, skipColor);
+			TS_ASSERT_SAME_DATA(target, expected, kRowWidth);
+		}
+	}
+
+public:
+	void test_draw_unscaled_cel() {
+		checkUnscaledCels(-1);
+	}
+
+	// A skip color of 255 makes the repeated skip pattern 0xFFFFFFFF
+	void test_draw_unscaled_cel_skip_255() {
+		checkUnscaledCels(255);
+	}
+
+	void test_draw_scaled_cel() {
+		checkScaledCels(-1);
+	}
+
+	void test_draw_scaled_cel_skip_255() {
+		checkScaledCels(255);
+	}
+
+	void test_copy_row_skip() {
+		checkCopyRowSkip(-1);
+	}
+
+	void test_copy_row_skip_255() {
+		checkCopyRowSkip(255);
+	}
+
+	void test_copy_row_no_remap() {
+		_seed = 1;
+		byte source[kRowWidth], target[kRowWidth], expected[kRowWidth];
+
+		for (int iteration = 0; iteration < 1000; ++iteration) {
+			const int16 width = getRandomNumber(kRowWidth);
+			const byte skipColor = getRandomNumber(255);
+			const byte startColor = 200 + getRandomNumber(55);
+			fillRow(source, kRowWidth, skipColor);
+			for (int x = 0; x < kRowWidth; ++x) {
+				target[x] = expected[x] = getRandomNumber(255);
+			}
+
+			for (int x = 0; x < width; ++x) {
+				if (source[x] != skipColor && source[x] < startColor) {
+					expected[x] = source[x];
+				}
+			}
+
+			Sci::copyCelRowNoRemap(target, source, width, skipColor, startColor);
+			TS_ASSERT_SAME_DATA(target, expected, kRowWidth);
+		}
+	}
+};
@@ -0,0 +1,47 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/scaler/intern.h"
+
+/**
+ * Checks that the vectorized pattern classification of the HQ scalers
+ * gives the same results as diffYUV.
+ */
+class HQPatternTestSuite : public CxxTest::TestSuite {
+public:
+	void test_pattern_matches_diffYUV() {
+#ifdef USE_SIMD_HQ_PATTERN
+		uint32 seed = 0xC0FFEE;
+		for (int i = 0; i < 100000; ++i) {
+			uint32 yuv[9];
+			for (int j = 0; j < 9; ++j) {
+				seed = seed * 1103515245 + 12345;
+				// Keep the components close to each other now and then, so
+				// that both sides of the thresholds get tested.
+				yuv[j] = (seed >> 8) & ((i & 1) ? 0x00FFFFFF : 0x003F0F0F);
+			}
+
+			const uint32 yuv5 = yuv[4];
+			int expected = 0;
+			for (int j = 0, bit = 0; j < 9; ++j) {
+				if (j == 4)
+					continue;
+				if (diffYUV(yuv5, yuv[j]))
+					expected |= 1 << bit;
+				++bit;
+			}
+
+			TS_ASSERT_EQUALS(patternYUV(yuv5, yuv[0], yuv[1], yuv[2], yuv[3], yuv[5], yuv[6], yuv[7], yuv[8]), expected);
+		}
+#endif
+	}
+
+	void test_pattern_thresholds() {
+#ifdef USE_SIMD_HQ_PATTERN
+		const uint32 c = 0x00808080;
+		// Differences right at the thresholds do not count
+		TS_ASSERT_EQUALS(patternYUV(c, c + 0x300000, c - 0x300000, c + 0x700, c - 0x700, c + 6, c - 6, c, c), 0);
+		// One above the thresholds does
+		TS_ASSERT_EQUALS(patternYUV(c, c + 0x310000, c, c - 0x800, c, c, c + 7, c, c - 0x310000), 0xA5);
+#endif
+	}
+};
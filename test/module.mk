@@ -8,11 +8,19 @@
 TESTS        := $(srcdir)/test/common/*.h $(srcdir)/test/audio/*.h
 TEST_LIBS    := audio/libaudio.a common/libcommon.a
 
+ifdef USE_HQ_SCALERS
+	TESTS += $(srcdir)/test/graphics/hqpattern.h
+endif
+
 ifeq ($(ENABLE_WINTERMUTE), STATIC_PLUGIN)
 	TESTS += $(srcdir)/test/engines/wintermute/*.h
 	TEST_LIBS += engines/wintermute/libwintermute.a
 endif
 
+ifeq ($(ENABLE_SCI), STATIC_PLUGIN)
+	TESTS += $(srcdir)/test/engines/sci/*.h
+endif
+
 ifeq ($(ENABLE_ULTIMA), STATIC_PLUGIN)
 	TESTS += $(srcdir)/test/engines/ultima/*/*/*.h
 	TEST_LIBS += engines/ultima/libultima.a
@@ -47,8 +55,14 @@ test/runner.cpp: $(TESTS)
 	@mkdir -p test
 	$(srcdir)/test/cxxtest/cxxtestgen.py $(TEST_FLAGS) -o $@ $+
 
+# Benchmark of the graphics scalers
+scaler-benchmark: test/scaler-benchmark
+	./test/scaler-benchmark
+test/scaler-benchmark: $(srcdir)/test/benchmark/scalers.cpp graphics/libgraphics.a common/libcommon.a
+	$(QUIET_CXX)$(CXX) $(TEST_CXXFLAGS) $(CPPFLAGS) -o $@ $+ $(TEST_LDFLAGS)
+
 clean: clean-test
 clean-test:
-	-$(RM) test/runner.cpp test/runner
+	-$(RM) test/runner.cpp test/runner test/scaler-benchmark
 
-.PHONY: test clean-test
+.PHONY: test clean-test scaler-benchmark